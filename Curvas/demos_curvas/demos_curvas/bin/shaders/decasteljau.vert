@@ -0,0 +1,10 @@
+#version 330 core
+
+// en coordenadas homogeneas (los puntos con peso), la gpu divide por w
+in vec4 vertexPosition;
+
+uniform mat4 projectionMatrix;
+
+void main() {
+	gl_Position = projectionMatrix * vertexPosition;
+}
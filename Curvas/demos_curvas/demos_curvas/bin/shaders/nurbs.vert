@@ -0,0 +1,15 @@
+#version 330 core
+
+// posicion en coordenadas homogeneas (x*w,y*w,z*w,w): la division por w la
+// hace la gpu, asi que los puntos de control se pasan tal como estan
+in vec4 vertexPosition;
+in vec3 vertexColor;
+
+uniform mat4 projectionMatrix;
+
+out vec3 fragmentColor;
+
+void main() {
+	gl_Position = projectionMatrix * vertexPosition;
+	fragmentColor = vertexColor;
+}
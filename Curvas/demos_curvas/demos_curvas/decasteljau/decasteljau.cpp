@@ -1,12 +1,14 @@
 #include <iostream> // cin, cout
 #include <cstdlib> // exit
 #include <cmath> // fabs sqrt
-#include <cstring> // memcpy
-#ifdef __APPLE__
-# include <GLUT/glut.h>
-#else
-# include <GL/glut.h>
-#endif
+#include <vector>
+#include <algorithm> // min
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include "Window.hpp"
+#include "Shaders.hpp"
 
 using namespace std;
 
@@ -14,23 +16,20 @@ using namespace std;
 // clase: puntos de cuatro floats
 // MANEJESE CON CUIDADO!!!
   // ==> OJO: no admite peso 0 !!!!!!!!!!!!!!!!!
-// 4 para poder hacer racionales y porque GLU pide 3D o 4D
-// floats porque GLU pide floats
+// 4 para poder hacer racionales (la gpu divide por w)
+// floats porque es lo que se sube al VBO
 // tiene solo lo necesario para usarlos aca
 // z siempre es 0
-const size_t SZF=sizeof(float);
+// (se copia con la copia por defecto, que es la del arreglo)
 class p4f{
   float c[4];
 public:
   p4f(double x=0, double y=0, double z=0, double w=1){
     c[0]=x; c[1]=y; c[2]=z; c[3]=w;
   }
-  p4f(const p4f &p){memcpy(c,p.c,4*SZF);}
 
   operator const float*() const {return c;}
 
-  p4f& operator=(const p4f &p){memcpy(c,p.c,4*SZF); return *this;}
-
   float& operator[](int i) {return c[i];}
   const float& operator[](int i) const {return c[i];}
 
@@ -50,15 +49,6 @@ public:
 
   p4f& neg(){c[0]=-c[0]; c[1]=-c[1]; c[2]=-c[2]; c[3]=-c[3]; return *this;}
   p4f operator -() const {return p4f(-c[0],-c[1],-c[2],-c[3]);}
-
-  // asigna el punto interpolado
-  p4f& lerp(const p4f& p0,const p4f& p1,float u){
-    c[0]=(1-u)*p0[0]+u*p1[0];
-    c[1]=(1-u)*p0[1]+u*p1[1];
-    c[2]=(1-u)*p0[2]+u*p1[2];
-    c[3]=(1-u)*p0[3]+u*p1[3];
-    return *this;
-  }
 };
 ///////////////////////////////////////////////////////////
 
@@ -67,27 +57,31 @@ int
   w,h, // alto y ancho de la pantalla
   tol=10, // tolerancia para seleccionar un punto
   yclick, // y picado
-  lod=32; // nivel de detalle (subdivisiones de lineas)
+  lod=32; // nivel de detalle (subdivisiones de lineas), nunca menos de 2
 
-float // colores
-  fondo[]={0.95f,0.98f,1.0f}, // color de fondo
-  lc_c[]={.4f,.4f,.6f,1.f},   // poligono de control
-  pc_c[]={.2f,.2f,.4f,1.f},   // puntos de control
-  c_c[]={.8f,.4f,.4f,1.f},    // curva
-  la_c[]={.6f,.8f,.6f,1.f},   // lineas accesorias
-  p_c[]={.4f,0.f,0.f,1.f};    // punto de la curva
+glm::vec4 // colores
+  fondo={0.95f,0.98f,1.0f,1.f}, // color de fondo
+  lc_c={.4f,.4f,.6f,1.f},   // poligono de control
+  pc_c={.2f,.2f,.4f,1.f},   // puntos de control
+  c_c={.8f,.4f,.4f,1.f},    // curva
+  la_c={.6f,.8f,.6f,1.f},   // lineas accesorias
+  p_c={.4f,0.f,0.f,1.f};    // punto de la curva
 
 bool
   cl_info=true,     // informa por la linea de comandos;
   antialias=false;  // antialiasing
 
 // DeCasteljau
-int npc=0,MAXPC=0; p4f *pc=0, *pd=0;  // puntos de control y DeCalsteljau
+int npc=0; vector<p4f> pc;  // puntos de control (sin limite de cantidad)
 int istep=-1; // pasos de interpolacion
 int pcsel=-1; // punto seleccionado
 float u=.5,u0,W0; // parametro variable y peso
 bool negativo=false; // muestra o no pesos negativos
 
+// mouse
+int modifiers=0;  // ctrl, alt, shift (de GLFW) al empezar el drag
+bool arrastrando=false;
+
 // funciones
 void check_gl_error(){
   int errornum=glGetError();
@@ -99,10 +93,8 @@ void check_gl_error(){
              cout << "GL_INVALID_VALUE" << endl;
       else if (errornum==GL_INVALID_OPERATION)
              cout << "GL_INVALID_OPERATION" << endl;
-      else if (errornum==GL_STACK_OVERFLOW)
-             cout << "GL_STACK_OVERFLOW" << endl;
-      else if (errornum==GL_STACK_UNDERFLOW)
-             cout << "GL_STACK_UNDERFLOW" << endl;
+      else if (errornum==GL_INVALID_FRAMEBUFFER_OPERATION)
+             cout << "GL_INVALID_FRAMEBUFFER_OPERATION" << endl;
       else if (errornum==GL_OUT_OF_MEMORY)
              cout << "GL_OUT_OF_MEMORY" << endl;
     }
@@ -110,60 +102,115 @@ void check_gl_error(){
   }
 }
 
- void salir(){
-  delete [] pd; delete [] pc;
-  exit(EXIT_SUCCESS);
+//--------
+// Evaluacion por lotes: en un solo arreglo de vertices (4 floats, en coords
+// homogeneas, que la gpu divide por w como antes glVertex4fv) van todos los
+// niveles de De Casteljau para u (el nivel j tiene npc-j puntos, uno atras
+// del otro, asi cada nivel es un line strip y el 0 es el poligono de
+// control) y despues las lod+1 muestras de la curva. Todo sale de una sola
+// pasada: los parametros (u y los de las muestras) se procesan en bloques,
+// con los puntos guardados por componente y por parametro; en cada nivel el
+// lazo interno hace la misma interpolacion para todo el bloque (y el
+// compilador la vectoriza). De u se guardan todos los niveles, de las
+// muestras solo el ultimo. Reemplaza a glMap1f/glEvalMesh1, que limitaban el
+// grado a GL_MAX_EVAL_ORDER, y a dibujar nivel por nivel con glBegin/glEnd
+vector<float> vertices; // lo que se dibuja, se sube entero al VBO
+const int BLOQUE=64; // parametros por bloque
+
+inline int primero_nivel(int j){return j*npc-j*(j-1)/2;} // del nivel j para u
+inline int primero_curva(){return npc*(npc+1)/2;}
+
+void evalua(){
+  int ns=lod+1;
+  vertices.resize(4*(primero_curva()+ns));
+  // u y los parametros de las muestras (el ultimo bloque se completa con 1,
+  // asi todos tienen BLOQUE elementos y el lazo interno es siempre el mismo)
+  vector<float> ts((ns+BLOQUE)/BLOQUE*BLOQUE,1.f);
+  ts[0]=u;
+  for (int s=0;s<ns;s++) ts[s+1]=float(s)/lod;
+  // x[(i*4+k)*BLOQUE+b]: componente k del punto i para el parametro b
+  static vector<float> x; x.resize(npc*4*BLOQUE);
+  for (int b0=0;b0<ns+1;b0+=BLOQUE){
+    int m=min(BLOQUE,ns+1-b0); const float *t=&ts[b0];
+    for (int i=0;i<npc;i++) for (int k=0;k<4;k++)
+      fill(&x[(i*4+k)*BLOQUE],&x[(i*4+k)*BLOQUE]+BLOQUE,pc[i][k]);
+    for (int j=1;j<npc;j++){
+      for (int i=0;i<npc-j;i++) for (int k=0;k<4;k++){
+        // en r (local) para que el compilador sepa que no se pisa con a, c ni t
+        float *a=&x[(i*4+k)*BLOQUE], r[BLOQUE]; const float *c=a+4*BLOQUE;
+        for (int b=0;b<BLOQUE;b++) r[b]=(1-t[b])*a[b]+t[b]*c[b];
+        copy(r,r+BLOQUE,a);
+      }
+      if (b0) continue; // el nivel j de u
+      float *v=&vertices[4*primero_nivel(j)];
+      for (int i=0;i<npc-j;i++) for (int k=0;k<4;k++) v[4*i+k]=x[(i*4+k)*BLOQUE];
+    }
+    for (int b=(b0?0:1);b<m;b++){ // la muestra b0+b-1 de la curva
+      float *v=&vertices[4*(primero_curva()+b0+b-1)];
+      for (int k=0;k<4;k++) v[k]=x[k*BLOQUE+b];
+    }
+  }
+  for (int i=0;i<npc;i++) for (int k=0;k<4;k++) vertices[4*i+k]=pc[i][k]; // nivel 0
 }
 
 //--------
+// el VBO donde se sube vertices (crece si hace falta, no se achica nunca)
+Shader *shader=0; // se crea con el contexto
+GLuint vao=0, vbo=0;
+int capacidad=0; // floats alojados en el VBO
+
+void crea_buffers(){
+  glGenVertexArrays(1,&vao);
+  glGenBuffers(1,&vbo);
+  glBindVertexArray(vao);
+  shader->setBuffer("vertexPosition",vbo,GL_FLOAT,4);
+  glBindVertexArray(0);
+}
+
+void sube_vertices(){
+  glBindBuffer(GL_ARRAY_BUFFER,vbo);
+  if (int(vertices.size())>capacidad){
+    capacidad=2*vertices.size();
+    glBufferData(GL_ARRAY_BUFFER,capacidad*sizeof(float),nullptr,GL_DYNAMIC_DRAW);
+  }
+  glBufferSubData(GL_ARRAY_BUFFER,0,vertices.size()*sizeof(float),vertices.data());
+}
+
+inline void color(const glm::vec4 &c){shader->setUniform("color",c);}
+
 void dibuja(){
   if (!npc) return;
-  glPointSize(3); glLineWidth(1);
-  
+  int i,j;
+
+  evalua();
+  sube_vertices();
+  glBindVertexArray(vao);
+  glPointSize(3);
+
   if (npc==1){ // dibuja el punto movil grueso
-    glColor3fv(p_c);
-    glBegin(GL_POINTS);
-      glVertex4fv(pc[0]);
-    glEnd();
+    color(p_c);
+    glDrawArrays(GL_POINTS,0,1);
     return;
   }
 
-  int i,j;
-
   // puntos de control
-  glColor4fv(pc_c); 
-  glBegin(GL_POINTS);
-  for (i=0;i<npc;i++) glVertex4fv(pc[i]);
-  glEnd();
+  color(pc_c);
+  glDrawArrays(GL_POINTS,0,npc);
   // poligono de control
-  glColor4fv(lc_c);
-  glBegin(GL_LINE_STRIP);
-  for (i=0;i<npc;i++) glVertex4fv(pc[i]);
-  glEnd();
+  color(lc_c);
+  glDrawArrays(GL_LINE_STRIP,0,npc);
 
   // dibuja la curva
-  glColor4fv(c_c); 
+  color(c_c);
   // curva de Bezier de grado npc-1
-  glMap1f(GL_MAP1_VERTEX_4, 0.0, 1.0, 4, npc, (const float*)pc);
-  glEnable(GL_MAP1_VERTEX_4);
-  glMapGrid1f(lod,0,1);
-  glEvalMesh1(GL_LINE,0,lod);
+  glDrawArrays(GL_LINE_STRIP,primero_curva(),lod+1);
 
   // dibuja las lineas auxiliares y el punto de la curva
   if (!istep) return;
-  for (i=0;i<npc;i++) glVertex4fv(pd[i]=pc[i]);
-  glColor3fv(la_c);
-  
-  for (j=0;j<istep-1;j++) {
-    glBegin(GL_LINE_STRIP);
-    for (i=0;i<npc-j-1;i++) glVertex4fv(pd[i].lerp(pd[i],pd[i+1],u));
-    glEnd();
-  }
-  glColor3fv(p_c);glBegin(GL_POINTS);
-    for (j=0;j<npc-istep;j++){
-	    glVertex4fv(pd[j].lerp(pd[j],pd[j+1],u));
-    }
-  glEnd();
+  color(la_c);
+  for (j=1;j<istep;j++) glDrawArrays(GL_LINE_STRIP,primero_nivel(j),npc-j);
+  color(p_c);
+  glDrawArrays(GL_POINTS,primero_nivel(istep),npc-istep);
 
   if (negativo){
     for (i=1;i<npc-1;i++) pc[i].neg();
@@ -172,175 +219,103 @@ void dibuja(){
   }
 }
 
-//============================================================
-// callbacks
-
 //------------------------------------------------------------
-// redibuja cada vez que hace un redisplay
-void Display_cb() { // Este tiene que estar
-  glClear(GL_COLOR_BUFFER_BIT);  // borra el buffer de pantalla
-  dibuja();
-  glutSwapBuffers();
+// acciones (del teclado y del panel)
 
-  check_gl_error();
+void informa_pesos(){
+  if (!cl_info || !npc) return;
+  cout << "Pesos: {";
+  for (int k=0;k<npc-1;k++) cout << pc[k][3] << ", ";
+  cout << pc[npc-1][3] << "}                         \r" << flush;
 }
 
-//------------------------------------------------------------
-// Maneja cambios de ancho y alto del screen
-void Reshape_cb(int wi, int hi){
-  w=wi;h=hi;
-//  if (cl_info) cout << "reshape " << w << "x" << h << endl;
+void informa_lod(){
+  if (!cl_info) return;
+  cout << "Nivel de Detalle: " << lod  << "               \r";
+  cout.flush();
+}
 
-  glViewport(0,0,w,h); // region donde se dibuja
+void cambia_antialias(){
+  antialias=!antialias;
+  // multisampling (la ventana se pide con 4 muestras)
+  if (antialias) glEnable(GL_MULTISAMPLE); else glDisable(GL_MULTISAMPLE);
+  if (cl_info) cout << (antialias ? "Antialiasing" : "Sin Antialiasing") << endl;
+}
 
-  // matriz de proyeccion
-  glMatrixMode(GL_PROJECTION);  glLoadIdentity();
-  glOrtho(-w/2,w-w/2,h-h/2,-h/2,-1,1);
+void mas_detalle(){
+  // no tiene sentido que divida mas que un segmento por pixel!!
+  int maxd=0; double d; // maxima distancia entre puntos de control
+  for (int i=0;i<npc-1;i++){
+    d=fabs(pc[i+1][0]-pc[i][0]); if (d>maxd) maxd=d;
+    d=fabs(pc[i+1][1]-pc[i][1]); if (d>maxd) maxd=d;
+  }
+  // limita el maximo, pero nunca por debajo del minimo de '-' (con todos
+  // los puntos juntos maxd es 0, y con lod=0 evalua dividiria por 0)
+  if (lod>=maxd) {lod=max(maxd,2); return;}
+  lod++;
+  informa_lod();
+}
 
-  glutPostRedisplay();
+void menos_detalle(){
+  if (lod<=2) return;
+  lod--;
+  informa_lod();
 }
 
-//------------------------------------------------------------
-// Teclado y Mouse
-// GLUT ACTIVE SHIFT Set if the Shift modifier or Caps Lock is active.
-// GLUT ACTIVE CTRL  Set if the Ctrl modifier is active.
-// GLUT ACTIVE ALT   Set if the Alt modifier is active.
-
-short modifiers=0;  // ctrl, alt, shift (de GLUT)
-inline short get_modifiers() {return modifiers=(short)glutGetModifiers();}
-
-// Maneja pulsaciones del teclado (ASCII keys)
-// x,y posicion del mouse cuando se teclea
-void Keyboard_cb(unsigned char key,int x=0,int y=0) {
-  if (key==27){ // escape => exit
-    get_modifiers();
-    if (!modifiers) salir();
-  }
-  else if (key>='0' && key<='0'+npc-1){ 
-	  istep=key-'0';
-	  glutPostRedisplay();
-  }
-  else if (key=='a'||key=='A'){ // Antialiasing
-    antialias=!antialias;
-    if (antialias){
-      glEnable(GL_BLEND);
-      glEnable(GL_POINT_SMOOTH); glEnable(GL_LINE_SMOOTH);
-      if (cl_info) cout << "Antialiasing" << endl;
-    }
-    else {
-      glDisable(GL_BLEND);
-      glDisable(GL_POINT_SMOOTH); glDisable(GL_LINE_SMOOTH);
-      if (cl_info) cout << "Sin Antialiasing" << endl;
-    }
-  }
-  else if (key=='+'){ // lod
-    // no tiene sentido que divida mas que un segmento por pixel!!
-    int maxd=0; double d; // maxima distancia entre puntos de control
-    for (int i=0;i<npc-1;i++){
-      d=fabs(pc[i+1][0]-pc[i][0]); if (d>maxd) maxd=d;
-      d=fabs(pc[i+1][1]-pc[i][1]); if (d>maxd) maxd=d;
-    }
-    if (lod>=maxd) {lod=maxd; return;} // limita el maximo
-    lod++;
-    if (cl_info) {
-      cout << "Nivel de Detalle: " << lod  << "               \r";
-      cout.flush();
-    }
-  }
-  else if (key=='-'){ // lod
-    if (lod==2) return;
-    lod--;
-    if (cl_info) {
-      cout << "Nivel de Detalle: " << lod  << "               \r";
-      cout.flush();
-    }
-  }
-  else if (key=='n'||key=='N'){ // negativo
-    negativo=!negativo;
-  }
+void borra_punto(){ // borra el seleccionado
+  if (npc==0 || pcsel<0) return;
+  pc.erase(pc.begin()+pcsel);
+  npc--; istep--; if (istep<0) istep=0;
+  if (pcsel==npc) pcsel--;
+  informa_pesos();
+}
+
+//============================================================
+// callbacks
+
+// teclas con caracter (numeros, letras, + y -)
+void charCallback(GLFWwindow* window, unsigned int key) {
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureKeyboard) return;
+  if (key>='0' && int(key)<='0'+npc-1) istep=key-'0';
+  else if (key=='a'||key=='A') cambia_antialias(); // Antialiasing
+  else if (key=='+') mas_detalle(); // lod
+  else if (key=='-') menos_detalle(); // lod
+  else if (key=='n'||key=='N') negativo=!negativo; // negativo
   else if (key=='i'||key=='I'){ // info
     cl_info=!cl_info;
     cout << ((cl_info)? "Info" : "Sin Info") << endl;
-    return;
   }
-  else if (key==127){ // del => borra pt
-    if (npc==0) return;
-    for (int i=pcsel;i<npc-1;i++)
-      pc[i]=pc[i+1];
-    npc--; istep--; if (istep<0) istep=0;
-    if (pcsel==npc) pcsel--;
-    if (cl_info) {
-      cout << "Pesos: {";
-      for (int k=0;k<npc-1;k++) cout << pc[k][3] << ", ";
-      cout << pc[npc-1][3] << "}                         \r" << flush;
-    }
-  }
-  glutPostRedisplay();
 }
 
-// Special keys (non-ASCII)
-//  GLUT KEY F[1,12] F[1,12] function key.
-//  GLUT KEY LEFT Left directional key.
-//  GLUT KEY UP Up directional key.
-//  GLUT KEY RIGHT Right directional key.
-//  GLUT KEY DOWN Down directional key.
-//  GLUT KEY PAGE UP Page up directional key.
-//  GLUT KEY PAGE DOWN Page down directional key.
-//  GLUT KEY HOME Home directional key.
-//  GLUT KEY END End directional key.
-//  GLUT KEY INSERT Inset directional key.
-
-// aca es int key
-void Special_cb(int key,int xm=0,int ym=0) {
-  if (key==GLUT_KEY_F4){ // alt+f4 => exit
-    get_modifiers();
-    if (modifiers==GLUT_ACTIVE_ALT) salir();
-  }
+// las que no tienen caracter (escape sale desde el loop de main)
+void keyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+  if (action!=GLFW_PRESS) return;
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureKeyboard) return;
+  if (key==GLFW_KEY_DELETE) borra_punto(); // del => borra pt
 }
 
-// Menu
-void Menu_cb(int value)
-{
-  switch (value){
-    case 'a':
-      Keyboard_cb('a');
-      return;
-    case '+':
-      Keyboard_cb('+');
-      return;
-    case '-':
-      Keyboard_cb('-');
-      return;
-    case 'n':
-      Keyboard_cb('n');
-      return;
-    case 127: // del = borra
-      Keyboard_cb(127);
-      return;
-    case 27: // esc = exit
-      salir();
-    }
+// posicion del mouse con el origen en el centro de la ventana
+void mouse_pos(GLFWwindow* window, int &x, int &y){
+  double xd,yd; glfwGetCursorPos(window,&xd,&yd);
+  x=int(xd)-w/2; y=int(yd)-h/2;
 }
-//------------------------------------------------------------
 
 // Movimientos del mouse
-void Motion_cb(int x, int y){ // drag
-  x-=w/2;y-=h/2;
-  if (modifiers==GLUT_ACTIVE_CTRL){ // cambia el peso
+void mouseMoveCallback(GLFWwindow* window, double, double) { // drag
+  if (!arrastrando) return;
+  int x,y; mouse_pos(window,x,y);
+  if (modifiers==GLFW_MOD_CONTROL){ // cambia el peso
 //    float W=W0*pow(10.0,int(20.0*4.0*(yclick-y)/h)/20.0);
     float W=W0+5.0*(yclick-y)/h;
     if (pcsel>=0&&pcsel<npc) pc[pcsel].peso(W);
-    if (cl_info) {
-      cout << "Pesos: {";
-      for (int k=0;k<npc-1;k++) cout << pc[k][3] << ", ";
-      cout << pc[npc-1][3] << "}                         \r" << flush;
-    }
+    informa_pesos();
   }
-  else if (modifiers==GLUT_ACTIVE_SHIFT){ // calcula u
+  else if (modifiers==GLFW_MOD_SHIFT){ // calcula u
     u=u0+int(20.0*(yclick-y)/h)/20.0;
     if (cl_info) {cout << "\rparametro: " << u << "         " << flush;}
   }
   else{
+    if (pcsel<0||pcsel>=npc) return;
     // mueve el punto
     // permite drag solo dentro del viewport
     // en caso contrario, sin zoom, no se pueden editar los que esten fuera
@@ -357,120 +332,66 @@ void Motion_cb(int x, int y){ // drag
     }
     pm.peso(pc[pcsel][3]); pc[pcsel]=pm; // mueve
   }
-  glutPostRedisplay();
 }
 
 // Clicks del mouse
-// GLUT LEFT BUTTON, GLUT MIDDLE BUTTON, or GLUT RIGHT BUTTON
-// The state parameter is either GLUT UP or GLUT DOWN
-// glutGetModifiers may be called to determine the state of modifier keys
-void Mouse_cb(int button, int state, int x, int y){
-  x-=w/2;y-=h/2;
-  if (button==GLUT_LEFT_BUTTON){
-    if (state==GLUT_DOWN) {
-      p4f pm(x,y);
-      int i;
-      // verifica tolerancia
-      for(i=0;i<npc;i++){
-        if (!pm.cerca2D(pc[i],tol)) continue;
-        pcsel=i;
-        glutMotionFunc(Motion_cb);
-        return;
-      }
-      // no pico cerca de ninguno
-      get_modifiers();
-      if (modifiers==GLUT_ACTIVE_CTRL    // cambia el peso
-        ||modifiers==GLUT_ACTIVE_SHIFT){ // cambia el parametro
-        yclick=y; u0=u; W0=pc[pcsel][3];
-        glutMotionFunc(Motion_cb);
-        return;
-      }
-      if (npc==MAXPC) return;
-      // agrega entre medio
-      for (i=npc;i>pcsel+1;i--) pc[i]=pc[i-1];
-      pc[i]=pm;
-      pcsel=i;
-      npc++; istep++;
-      if (cl_info) {
-        cout << "Pesos: {";
-        for (int k=0;k<npc-1;k++) cout << pc[k][3] << ", ";
-        cout << pc[npc-1][3] << "}                         \r" << flush;
-      }
-      glutPostRedisplay();
-      glutMotionFunc(Motion_cb);
-    } // down
-    else if (state==GLUT_UP){// fin del drag
-      glutMotionFunc(NULL); // anula el callback para los drags
-      modifiers=0;
-    } // up
-  } // left
+void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+  if (button!=GLFW_MOUSE_BUTTON_LEFT) return;
+  if (action==GLFW_RELEASE){ // fin del drag
+    arrastrando=false;
+    modifiers=0;
+    return;
+  }
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureMouse) return;
+  int x,y; mouse_pos(window,x,y);
+  p4f pm(x,y);
+  int i;
+  // verifica tolerancia
+  for(i=0;i<npc;i++){
+    if (!pm.cerca2D(pc[i],tol)) continue;
+    pcsel=i;
+    arrastrando=true;
+    return;
+  }
+  // no pico cerca de ninguno
+  modifiers=mods&(GLFW_MOD_CONTROL|GLFW_MOD_SHIFT|GLFW_MOD_ALT);
+  if (modifiers==GLFW_MOD_CONTROL    // cambia el peso
+    ||modifiers==GLFW_MOD_SHIFT){ // cambia el parametro
+    yclick=y; u0=u; W0=(pcsel>=0)? pc[pcsel][3] : 1;
+    arrastrando=true;
+    return;
+  }
+  // agrega entre medio
+  modifiers=0;
+  pcsel++;
+  pc.insert(pc.begin()+pcsel,pm);
+  npc++; istep++;
+  informa_pesos();
+  arrastrando=true;
 }
 
 //------------------------------------------------------------
-int integerv(GLenum pname){
-  int value;
-  glGetIntegerv(pname,&value);
-  return value;
-}
-#define _PRINT_INT_VALUE(pname) #pname << ": " << integerv(pname) <<endl
+// main
+int main() {
+  Window window(640,480,"De Casteljau",Window::fAntialiasing|Window::fVSync);
+  glfwSetKeyCallback(window, keyboardCallback);
+  glfwSetCharCallback(window, charCallback);
+  glfwSetMouseButtonCallback(window, mouseButtonCallback);
+  glfwSetCursorPosCallback(window, mouseMoveCallback);
 
-//------------------------------------------------------------
-// Inicializa GLUT y OpenGL
-void initialize() {
-  // pide color RGB y double buffering
-  glutInitDisplayMode(GLUT_RGBA|GLUT_DOUBLE);
-
-  glutInitWindowSize(640,480); glutInitWindowPosition(250,100);
-
-  glutCreateWindow("De Casteljau"); // crea el main window
-
-  //declara los callbacks
-  //los que no se usan no se declaran
-  glutDisplayFunc(Display_cb); // redisplays
-  glutReshapeFunc(Reshape_cb); // resize
-  glutKeyboardFunc(Keyboard_cb); // teclado
-  glutSpecialFunc(Special_cb); // ctrl alt y shift
-  glutMouseFunc(Mouse_cb); // clicks
-  glutMotionFunc(Motion_cb); // clicks
-
-  glutCreateMenu(Menu_cb);
-    glutAddMenuEntry("[Del] Borra Punto de Control", 127);
-    glutAddMenuEntry("[+] +Nivel de Detalle     ", '+');
-    glutAddMenuEntry("[-] -Nivel de Detalle     ", '-');
-    glutAddMenuEntry("[n] -Pesos negativos      ", 'n');
-    glutAddMenuEntry("[a] Antialiasing ON/OFF", 'a');
-    glutAddMenuEntry("---------------------------", 255);
-    glutAddMenuEntry("[i] Info ON/OFF", 'i');
-    glutAddMenuEntry("[Esc] Exit", 27);
-  glutAttachMenu(GLUT_RIGHT_BUTTON);
+  Shader shader_dc("shaders/decasteljau"); shader=&shader_dc;
+  crea_buffers();
 
   // ========================
   // estado normal del OpenGL
   // ========================
   glClearColor(fondo[0],fondo[1],fondo[2],1);  // color de fondo
-  glDrawBuffer(GL_BACK);
-  glMatrixMode(GL_MODELVIEW); glLoadIdentity(); // constante
-  glShadeModel(GL_FLAT); // no interpola color
-
-  if (antialias){
-    glEnable(GL_BLEND);
-    glEnable(GL_POINT_SMOOTH); glEnable(GL_LINE_SMOOTH);
-  }
-  else {
-    glDisable(GL_BLEND);
-    glDisable(GL_POINT_SMOOTH); glDisable(GL_LINE_SMOOTH);
-  }
-  glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
-  
-
-  // maximo orden y arrays de puntos
-  glGetIntegerv(GL_MAX_EVAL_ORDER,&MAXPC);
-  pc=new p4f[MAXPC]; pd=new p4f[MAXPC];
+  if (!antialias) glDisable(GL_MULTISAMPLE);
 
   // ========================
   // info
   if (cl_info){
-      cout << "\n\n\nPuntos de control (Maximo " << MAXPC << "):\n"
+      cout << "\n\n\nPuntos de control:\n"
          << "     Click izq -> Selecciona (tol. 10) o\n"
             "                    Agrega despues del seleccionado\n"
          << "      Drag izq -> Mueve el seleccionado\n"
@@ -479,13 +400,40 @@ void initialize() {
          << "Shift+Drag izq -> Cambia el parametro\n"
          << endl;
   }
-}
 
-//------------------------------------------------------------
-// main
-int main(int argc,char** argv) {
-  glutInit(&argc,argv);// inicializa glut
-  initialize(); // condiciones iniciales de la ventana y OpenGL
-  glutMainLoop(); // entra en loop de reconocimiento de eventos
-  return 0; //solo para que el builder se quede tranquilo (aqui nunca llega)
+  do {
+    glClear(GL_COLOR_BUFFER_BIT);  // borra el buffer de pantalla
+
+    // origen en el centro y y hacia abajo, como las coordenadas del mouse
+    glfwGetFramebufferSize(window,&w,&h);
+    shader->use();
+    shader->setUniform("projectionMatrix",glm::ortho(float(-w/2),float(w-w/2),float(h-h/2),float(-h/2),-1.f,1.f));
+    dibuja();
+    glBindVertexArray(0);
+
+    // el menu del boton derecho de la version GLUT
+    window.ImGuiDialog("De Casteljau",[&](){
+      if (ImGui::Button("Borra Punto de Control (Del)")) borra_punto();
+      if (ImGui::Button("+ Nivel de Detalle (+)")) mas_detalle();
+      ImGui::SameLine();
+      if (ImGui::Button("- (-)")) menos_detalle();
+      ImGui::Checkbox("Pesos negativos (N)",&negativo);
+      bool aa=antialias;
+      if (ImGui::Checkbox("Antialiasing (A)",&aa)) cambia_antialias();
+      ImGui::Checkbox("Info (I)",&cl_info);
+      ImGui::Separator();
+      ImGui::Text("Puntos: %i  Paso: %i  Detalle: %i",npc,istep,lod);
+      ImGui::Text("u: %.2f",u);
+      ImGui::TextDisabled("0-9: pasos de De Casteljau");
+    });
+
+    glfwSwapBuffers(window);
+    check_gl_error();
+    glfwPollEvents();
+  } while( glfwGetKey(window,GLFW_KEY_ESCAPE)!=GLFW_PRESS && !glfwWindowShouldClose(window) );
+
+  glDeleteBuffers(1,&vbo);
+  glDeleteVertexArrays(1,&vao);
+  shader=0;
+  return 0;
 }
@@ -17,7 +17,7 @@ public:
     PersistentMode, // el contenido de un frame se mantiene mientras nadie escriba nada nuevo
     ManualMode // el contenido se mantiene siempre, se acumula todo
   };
-  void Render(int w, int h, bool align_bottom=false);
+  void Render(int w, int h, const float *color, bool align_bottom=false);
   OSD_t &operator<<(const char c) { text+=c; return *this; }
   OSD_t &operator<<(const char *s) { text+=s; return *this; }
   OSD_t &operator<<(const std::string &s) { text+=s; return *this; }
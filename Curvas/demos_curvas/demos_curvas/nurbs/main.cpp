@@ -3,13 +3,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
-#ifdef __APPLE__
-# include <OpenGL/gl.win_h>
-# include <GLUT/glut.win_h>
-#else
-# include <GL/gl.h>
-# include <GL/glut.h>
-#endif
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "Window.hpp"
 #include "OSD.hpp"
 #include "nurbs.h"
 #include "render.h"
@@ -89,7 +86,7 @@ bool draw_w1=true;
 bool draw_parts=false;
 bool animate_t=false;
 
-int knots_nodes[ARRAY_MAX];
+std::vector<int> knots_nodes;
 
 NURBS nurbs;
 
@@ -106,7 +103,6 @@ static void update_selections() {
 	if (draw_detail && x>win_w-MARGIN-10 && x<win_w-MARGIN+10 && y>detail_pos-10 && y<detail_pos+10) {
 		sel_detail=true;
 		OSD<<"tol = "<<nurbs.detail << '\n';
-		glutPostRedisplay();
 		
 	} else {
 		if (sel_detail) {
@@ -117,6 +113,7 @@ static void update_selections() {
 		// knots/u sobre la linea de knots
 		if (!animate_t && draw_kline && y<win_h-MARGIN+10 && y>win_h-MARGIN-10) { // seleccion en la linea de los knots
 			int min_d=5, m_ksel=SEL_NONE;
+			knots_nodes.resize(nurbs.knum);
 			for (int i=0;i<nurbs.knum;i++) { 
 				int d1 = knots_nodes[i]>x? knots_nodes[i]-x : x-knots_nodes[i]; 
 				if (d1<min_d) {
@@ -203,7 +200,6 @@ static void update_selections() {
 			}
 		}
 		
-		glutPostRedisplay();
 	}
 	mouse_moved=false;
 }
@@ -215,14 +211,12 @@ static void motion_cb(int x, int y) {
 	if (drag==MT_CONTROL) { // si se esta arrastrando un punto de control
 		nurbs.controls[sel_control][X]=x*nurbs.controls[sel_control][W];
 		nurbs.controls[sel_control][Y]=y*nurbs.controls[sel_control][W];
-		glutPostRedisplay();
 	} else if (drag==MT_COORD_W) { // si se esta cambiando la win_w de un pto de control
 		float oldW=nurbs.controls[sel_control][W], newW=last_w+float(last_my-y)/20;
 		if (newW==0) newW=1e-10;
 		nurbs.controls[sel_control][X]*=newW/oldW;
 		nurbs.controls[sel_control][Y]*=newW/oldW;
 		nurbs.controls[sel_control][W]=newW;
-		glutPostRedisplay();
 		OSD << "pto control " << sel_control << "  -  win_w = " << nurbs.controls[sel_control][W] << '\n';
 	} else if (drag==MT_KNOT) { // si se esta arrastrando un knot
 		float p=float(x-MARGIN+sel_x)/(knot_line);
@@ -234,7 +228,6 @@ static void motion_cb(int x, int y) {
 			nurbs.knots[sel_knot]=nurbs.knots[sel_knot+1];
 		else
 			nurbs.knots[sel_knot]=p;
-		glutPostRedisplay();
 		OSD << "knot " << sel_knot << "  -  u = " << nurbs.knots[sel_knot] << '\n';
 	} else if (drag==MT_DETAIL) { // si se esta cambiando la tolerancia para el dibujo
 		float d = float(y-MARGIN)/detail_line;
@@ -243,20 +236,24 @@ static void motion_cb(int x, int y) {
 			detail_pos = y;
 		}
 		OSD << "tol = " << nurbs.detail+1 << '\n';
-		glutPostRedisplay();
 	} else if (drag==MT_MOVE) {
 		offset_x = int(last_ox+(x-last_mx));
 		offset_y = int(last_oy+(y-last_my));
-		glutPostRedisplay();
 	} else {
 		if (!freeze_selections) update_selections();
 	}
 }
 
+static void cursor_pos_cb(GLFWwindow *window, double x, double y) {
+	motion_cb(int(x),int(y));
+}
+
 // callback del mouse de la ventana de imagenes
-static void mouse_cb(int button, int state, int x, int y){
-	if (button==GLUT_LEFT_BUTTON) {
-		if (state==GLUT_DOWN) {
+static void mouse_cb(GLFWwindow *window, int button, int action, int mods){
+	double xd,yd; glfwGetCursorPos(window,&xd,&yd);
+	int x=int(xd), y=int(yd);
+	if (button==GLFW_MOUSE_BUTTON_LEFT) {
+		if (action==GLFW_PRESS) {
 			if (freeze_selections) { update_selections(); return; }
 			if (drag==MT_NONE) {
 				if (sel_detail)
@@ -272,27 +269,19 @@ static void mouse_cb(int button, int state, int x, int y){
 						drag = MT_KNOT;
 						sel_knot = nurbs.InsertKnot(float(sel_x-MARGIN)/knot_line);
 						sel_x=MARGIN+knot_line*nurbs.knots[sel_knot]-x;
-						glutPostRedisplay();
 					}
 				} else { // agregar un punto de control
 					OSD << "pto control " << nurbs.num << '\n';
 					drag=MT_CONTROL;
 					sel_control = nurbs.AddControlPoint(x,y);
-					glutPostRedisplay();
 				}
 			}
 		} else {
 			drag = MT_NONE;
 			motion_cb(x,y);
 		}
-	} else 	if (button==3) {
-		nurbs.ZoomIn(x,y);
-		glutPostRedisplay();
-	} else 	if (button==4) {
-		nurbs.ZoomOut(x,y);
-		glutPostRedisplay();
-	} else 	if (button==GLUT_RIGHT_BUTTON) {
-		if (state==GLUT_DOWN) {
+	} else 	if (button==GLFW_MOUSE_BUTTON_RIGHT) {
+		if (action==GLFW_PRESS) {
 			if (sel_control!=SEL_NONE) {
 				last_my = y;
 				last_w = nurbs.controls[sel_control][W];
@@ -313,7 +302,14 @@ static void mouse_cb(int button, int state, int x, int y){
 
 }
 
-static void reshape_cb(int aw, int ah){
+// rueda del mouse: zoom en torno al cursor
+static void scroll_cb(GLFWwindow *window, double xoffset, double yoffset) {
+	double x,y; glfwGetCursorPos(window,&x,&y);
+	if (yoffset>0) nurbs.ZoomIn(int(x),int(y));
+	else if (yoffset<0) nurbs.ZoomOut(int(x),int(y));
+}
+
+static void reshape_cb(GLFWwindow *window, int aw, int ah){
 	win_w=aw;win_h=ah;
 
 	if (!win_h||!win_w) return;
@@ -322,31 +318,25 @@ static void reshape_cb(int aw, int ah){
 	knot_line=win_w-30;
 	detail_line=win_h-MARGIN*3;
 	detail_pos = int(MARGIN+pow((nurbs.detail-1)/MAX_DETAIL,1.0/3.0)*detail_line);
-
-	// matriz de proyeccion
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity();
-	glOrtho(0,win_w,win_h,0,-1,1);
-
-	glutPostRedisplay();
+	// la proyeccion (glOrtho(0,win_w,win_h,0,-1,1)) la arma display_cb
 }
 
 static void idle_cb() {
-	static int anterior = glutGet(GLUT_ELAPSED_TIME); // milisegundos desde que arranco
-	int tiempo = glutGet(GLUT_ELAPSED_TIME), lapso=tiempo-anterior;
+	static int anterior = int(glfwGetTime()*1000); // milisegundos desde que arranco
+	int tiempo = int(glfwGetTime()*1000), lapso=tiempo-anterior;
 	constexpr int msecs_per_frame=20; 
 	if (lapso<msecs_per_frame) return;
 	anterior = tiempo;
 	sel_x += animate_speed; if (sel_x>win_w) sel_x=0;
 	sel_knot = SEL_NEW;
-	glutPostRedisplay();
 }
 
 // callback del teclado
-static void keyboard_cb(unsigned char key,int x=0,int y=0) {
+static void keyboard_cb(GLFWwindow *window, unsigned char key, int x, int y) {
 	switch(tolower(key)) {
 	case 27:
-		exit(0);
+		glfwSetWindowShouldClose(window,GLFW_TRUE);
+		break;
 	case 'h':
 		OSD<<help_text<<'\n';
 		break;
@@ -468,7 +458,6 @@ static void keyboard_cb(unsigned char key,int x=0,int y=0) {
 		break;
 	case 'a':
 		animate_t = !animate_t;
-		glutIdleFunc(animate_t?idle_cb:nullptr);
 		break;
 	case 'u':
 		draw_parts = !draw_parts;
@@ -485,46 +474,59 @@ static void keyboard_cb(unsigned char key,int x=0,int y=0) {
 	default:
 		;
 	}
-	glutPostRedisplay();
 }
 
-static void init() {
+// teclas con caracter (las letras llegan como se escribieron, con o sin shift)
+static void char_cb(GLFWwindow *window, unsigned int codepoint) {
+	if (codepoint>=128) return;
+	double x,y; glfwGetCursorPos(window,&x,&y);
+	keyboard_cb(window,codepoint,int(x),int(y));
+}
+
+// las que no tienen caracter: escape y delete (el 27 y el 127 de glut)
+static void key_cb(GLFWwindow *window, int key, int scancode, int action, int mods) {
+	if (action!=GLFW_PRESS) return;
+	double x,y; glfwGetCursorPos(window,&x,&y);
+	if (key==GLFW_KEY_ESCAPE) keyboard_cb(window,27,int(x),int(y));
+	else if (key==GLFW_KEY_DELETE) keyboard_cb(window,127,int(x),int(y));
+}
+
+static void init(GLFWwindow *window) {
 	
 	OSD.SetMode(OSD_t::PersistentMode);
 	OSD<<"(presione H para ver la ayuda)"<<'\n';
 	
-	glutInitDisplayMode(GLUT_RGB|GLUT_DOUBLE);
-	
-	glutInitWindowSize(win_w,win_h); 
-	glutInitWindowPosition(100,100);
-	glutCreateWindow("NURBS Demo");
-	glMatrixMode(GL_PROJECTION); 
-	glOrtho(0,win_w,0,win_h,1,1);
+	glfwSetMouseButtonCallback(window, mouse_cb);
+	glfwSetCursorPosCallback(window, cursor_pos_cb);
+	glfwSetScrollCallback(window, scroll_cb);
+	glfwSetCharCallback(window, char_cb);
+	glfwSetKeyCallback(window, key_cb);
+	glfwSetFramebufferSizeCallback(window, reshape_cb);
 	
-	glutDisplayFunc(display_cb);
-	glutMouseFunc(mouse_cb);
-	glutKeyboardFunc(keyboard_cb);
-	glutMotionFunc(motion_cb);
-	glutPassiveMotionFunc(motion_cb);
-	glutReshapeFunc(reshape_cb);
-	
-	knot_line=win_w-MARGIN*2;
-	detail_line=win_h-MARGIN*3;
-	detail_pos = int(MARGIN+pow((nurbs.detail-1)/MAX_DETAIL,1.0/3.0)*detail_line);
-	glMatrixMode(GL_MODELVIEW); 
-	glLoadIdentity();
+	int w,h; glfwGetFramebufferSize(window,&w,&h);
+	reshape_cb(window,w,h);
 	
 }
 
 int main(int argc, char *argv[]){
-	glutInit(&argc,argv); // inicializa glut
-	init();
+	Window window(win_w,win_h,"NURBS Demo",Window::fAntialiasing|Window::fVSync);
+	init(window);
 	if (argc==1) {
 		nurb_file = "nurbs.nurbs";
 	} else {
 		nurb_file = argv[1];
-		nurbs.Load(nurb_file);
+		if (!nurbs.Load(nurb_file))
+			std::cerr << "No se pudo cargar la curva de " << nurb_file << std::endl;
 	}
-	glutMainLoop(); 
+	render_init();
+	do {
+		if (animate_t) idle_cb();
+		window.ImGuiFrame(display_cb);
+		glfwSwapBuffers(window);
+		// sin animacion espera eventos (como glut, que solo redibujaba si pasaba algo)
+		if (animate_t) glfwPollEvents();
+		else glfwWaitEvents();
+	} while (!glfwWindowShouldClose(window));
+	render_free();
 	return 0;
 }
@@ -1,12 +1,13 @@
 #ifndef NURBS_H
 #define NURBS_H
 
-#include <cstring>
+#include <algorithm>
 #include <fstream>
+#include <vector>
+#include "nurbs_eval.h"
 
 #define _expects(cond) { if (!(cond)) asm("int3"); asm("nop"); }
 
-#define ARRAY_MAX 1000
 #define ZOOM_FACTOR 1.1
 #define SEL_NONE -1
 #define SEL_NEW -2
@@ -19,31 +20,43 @@ enum {
 };
 
 
+// N coordenadas que se usan como un arreglo comun (c[X], glVertex4fv(c), etc)
+// pero se pueden guardar en un std::vector
+template<typename T, int N>
+struct Coords {
+	T v[N];
+	operator T*() { return v; }
+	operator const T*() const { return v; }
+};
+
 struct NURBS {
-	GLfloat controls[ARRAY_MAX][4]; // puntos de control (x,y,z,w)
-	GLfloat knots[ARRAY_MAX]; // knots
+	// los vectores tienen siempre num pts de control y knum knots
+	std::vector<Coords<GLfloat,4>> controls; // puntos de control (x,y,z,w)
+	std::vector<GLfloat> knots; // knots
 	int num; // cantidad de pts de control
 	int order; // orden de la curva ( = grado+1 )
 	int knum; // cantidad de knots ( = num + order )
 	float detail; // tolerancia para el rasterizado de opengl
-	int knots_points[ARRAY_MAX][2]; // coord donde se dibujan los knots en la ventana
-	GLfloat aux_c[10][10][4]; // auxiliar (para InsertKnot)
-	
-	NURBS &operator=(const NURBS &n2) = delete;
-	NURBS(const NURBS &n2) {
-		detail=n2.detail;
-		num=n2.num;
-		knum=n2.knum;
-		order=n2.order;
-		std::memcpy((void*)controls,(void*)n2.controls,sizeof(float)*4*num);
-		std::memcpy((void*)knots,(void*)n2.knots,sizeof(float)*ARRAY_MAX);
-	}
+	std::vector<Coords<int,2>> knots_points; // coord donde se dibujan los knots en la ventana
+	GLfloat aux_c[NURBS_EVAL_MAX_ORDER][NURBS_EVAL_MAX_ORDER+2][4]; // auxiliar (para FindPoint)
 	
 	NURBS () {
 		detail=25;
 		Clear();
 	}
 	
+	// prepara un NurbsEval para evaluar la curva, o solo los tramos entre los
+	// knots from y to+1 (order-1 <= from <= to < num), sin copiar nada: los
+	// knots from-order+1 a to+order y los pts de control from-order+1 a to
+	// forman una nurbs cuyo dominio son exactamente esos tramos
+	void SetupEval(NurbsEval &ev) const { 
+		SetupEval(ev,order-1,num-1);
+	}
+	void SetupEval(NurbsEval &ev, int from, int to) const {
+		int first = std::max(from-order+1,0);
+		ev.Setup(knots.data()+first, controls.empty() ? nullptr : &controls[first][0], std::max(to-first+1,0), order);
+	}
+	
 	void Move(int x, int y) {
 		for (int i=0;i<num;i++) {
 			float w=controls[i][W];
@@ -55,11 +68,11 @@ struct NURBS {
 	void Clear() {
 		num=0;
 		knum=order=4;
-		knots[0]=0; knots[order-1]=1;
+		controls.clear();
+		knots.resize(knum);
 		for (int i=0;i<order;i++)
 			knots[i]=(i-1)*1.f/(order-3);
-		for (int i=order-1;i<ARRAY_MAX;i++)
-			knots[i]=1;
+		knots[order-1]=1;
 	}
 	
 	
@@ -96,13 +109,17 @@ struct NURBS {
 		_expects(order>0&&order<1e3);
 		_expects(num>=0&&num<1e3);
 		if (num<order) return SEL_NONE;
-		NURBS n2(*this);
+		// las inserciones se hacen sobre una copia que se reutiliza (no aloca
+		// nada mientras la curva no crezca)
+		static NURBS n2; n2 = *this;
 		_expects(n2.order==order&&n2.num==num);
 		int k1 = n2.InsertKnot(knots[order-1],true);
 		_expects(n2.order==order&&n2.num<num+order);
 		int k2 = n2.InsertKnot(knots[knum-order],true);
 		_expects(n2.order==order&&n2.num<num+2*order);
-		float u = n2.FindUbb(n2,x,y,knots[order-1],knots[knum-order],k1-order+1,k2-order+1,tol);
+		// (si el final ya interpolaba, k2 es el ultimo knot repetido y no el
+		// del ultimo pto de control)
+		float u = n2.FindUbb(n2,x,y,knots[order-1],knots[knum-order],k1-order+1,std::min(k2-order+1,n2.num-1),tol);
 		return u;
 	}
 	
@@ -158,16 +175,23 @@ struct NURBS {
 		
 		int degree = order -1;
 		
+		// fuera del dominio de la curva (knots[degree] a knots[num]) se leerian
+		// knots y pts de control antes del principio del arreglo
+		t = std::max(knots[degree],std::min(knots[num],t));
+		
 		// buscar donde va el knot
 		int k=0; while (k<knum && knots[k]<t) k++;
 		// cuantas veces se repite
 		int s=0; while (k<knum && knots[k]==t) { k++; s++; } k--;
+		// en el extremo final no hay un span a la derecha, se evalua el ultimo
+		// desde la izquierda (sino se leen knots despues del final del arreglo)
+		if (k>=num) { k=num-1; while (k>degree && knots[k]>=t) k--; s=0; }
 		// corregir el extremo inferior para que no se salga
 		if(degree-s<1) s=degree-1;
 		// inicializar el vector auxiliar donde se van a guardar los pasos
 		// (solo se guardan los ultimos dos, alternando entre las cols 0 y 1)
 		for (int i=k-degree,p=0;i<=k-s+2;i++,p++) {
-			int j = i>=num ? num-1 : i;
+			int j = std::max(0,std::min(num-1,i));
 			aux_c[0][p][X]=controls[j][X];
 			aux_c[0][p][Y]=controls[j][Y];
 			aux_c[0][p][Z]=controls[j][Z];
@@ -194,13 +218,11 @@ struct NURBS {
 	
 	int AddControlPoint(GLfloat x, GLfloat y) {
 		// order = degree+1 = knum-cnum => knum = order+cnum
-		controls[num][X]=x;
-		controls[num][Y]=y;
-		controls[num][Z]=0;
-		controls[num][W]=1;
+		controls.push_back({{x,y,0,1}});
 		for (int i=0;i<knum-1;i++) {
 			knots[i]*=1-1.f/(knum-2);
 		}
+		knots.push_back(1);
 		num++; knum++;
 		return num-1;
 	}
@@ -230,22 +252,18 @@ struct NURBS {
 		if (s>=order-(to_interpolate?1:0)) {
 			return k;
 		}
+		// fuera del dominio no hay pts de control suficientes para combinar
+		if (num==0 || k<order-1 || k>num) return k;
 		
 		do {
 			if (num_insertados) ++(*num_insertados);
-			// hacer lugar para el nuevo knot
-			for (int i=knum;i>k;i--) 
-				knots[i+1]=knots[i];
 			// insertar el knot
-			knots[k+1]=t;
+			knots.insert(knots.begin()+k+1,t);
 			
-			// hacer lugar para el nuevo punto de control
-			for (int i=knum;i>k;i--) {
-				controls[i][X]=controls[i-1][X];
-				controls[i][Y]=controls[i-1][Y];
-				controls[i][Z]=controls[i-1][Z];
-				controls[i][W]=controls[i-1][W];
-			}
+			// hacer lugar para el nuevo punto de control (duplicando el k, o el
+			// ultimo si el knot es el final del dominio, que queda con a=0)
+			Coords<GLfloat,4> dup = controls[std::min(k,num-1)];
+			controls.insert(controls.begin()+std::min(k+1,num),dup);
 			// acomodar los pts de control que corresponda
 			GLfloat lc[4]={0};
 			lc[X]=controls[k-order+1][X];
@@ -295,6 +313,7 @@ struct NURBS {
 	void SetDegree(int n) {
 		order=n+1;
 		knum=order+num;
+		knots.resize(knum,1);
 		ResetKnots(true);
 	}
 	
@@ -304,15 +323,8 @@ struct NURBS {
 	void DeleteControl(int n) {
 		num--;
 		knum--;
-		for (int i=n;i<num;i++) {
-			controls[i][X]=controls[i+1][X];
-			controls[i][Y]=controls[i+1][Y];
-			controls[i][Z]=controls[i+1][Z];
-			controls[i][W]=controls[i+1][W];
-		}
-		for (int i=n;i<knum;i++)
-			knots[i]=knots[i+1];
-		knots[knum]=1;
+		controls.erase(controls.begin()+n);
+		knots.erase(knots.begin()+n);
 	}
 	
 	
@@ -379,32 +391,44 @@ struct NURBS {
 		for (i=0;i<num;i++)
 			fil << controls[i][X] << " " << controls[i][Y] << " " 
 				<< controls[i][Z] << " " << controls[i][W] << std::endl;
-			fil << "knots " << knum << std::endl;
-			for (i=0;i<knum;i++)
-				fil << knots[i] << std::endl;
-			fil << "detail " << detail << std::endl;
-			fil.close();
+		fil << "knots " << knum << std::endl;
+		for (i=0;i<knum;i++)
+			fil << knots[i] << std::endl;
+		fil << "detail " << detail << std::endl;
+		fil.close();
 	}
+	// si el archivo no se puede leer, esta incompleto o no es una nurbs valida
+	// (knum!=num+order, orden fuera de 2..NURBS_EVAL_MAX_ORDER, menos pts que
+	// el orden, knots decrecientes) devuelve false y la curva queda como estaba
 	bool Load(const std::string &fname) {
 		std::ifstream fil(fname.c_str());
-		if (fil.is_open()) {
-			std::string s;
-			fil >> s >> order;
-			fil >> s >> num;
-			int i;
-			for (i=0;i<num;i++)
-				fil >> controls[i][X] >> controls[i][Y] 
-					>> controls[i][Z] >> controls[i][W];
-				fil >> s >> knum;
-				for (i=0;i<knum;i++)
-					fil >> knots[i];
-				fil >> s >> detail;
-				return true;
+		if (!fil.is_open()) return false;
+		std::string s;
+		int n_order, n_num, n_knum;
+		float n_detail;
+		if (!(fil >> s >> n_order) || n_order<2 || n_order>NURBS_EVAL_MAX_ORDER) return false;
+		if (!(fil >> s >> n_num) || n_num<n_order) return false;
+		std::vector<Coords<GLfloat,4>> n_controls;
+		for (int i=0;i<n_num;i++) {
+			Coords<GLfloat,4> c;
+			if (!(fil >> c[X] >> c[Y] >> c[Z] >> c[W])) return false;
+			n_controls.push_back(c);
+		}
+		if (!(fil >> s >> n_knum) || n_knum!=n_num+n_order) return false;
+		std::vector<GLfloat> n_knots;
+		for (int i=0;i<n_knum;i++) {
+			GLfloat k;
+			if (!(fil >> k) || (i>0 && k<n_knots.back())) return false;
+			n_knots.push_back(k);
 		}
-		return false;
+		if (!(fil >> s >> n_detail)) return false;
+		order = n_order; num = n_num; knum = n_knum; detail = n_detail;
+		controls.swap(n_controls); knots.swap(n_knots);
+		return true;
 	}
 	
 	void CalcKNots() {
+		knots_points.resize(knum);
 		// (por alguna razon los de los extremos (p primeros y p ultimos) no tienen sentido, asi que no se dibujan
 		for (int i=order;i<knum-order;i++) {
 			float *p=FindPoint(knots[i]);
@@ -0,0 +1,171 @@
+#ifndef NURBS_EVAL_H
+#define NURBS_EVAL_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Evaluador de NURBS (reemplaza a gluNurbsCurve): trabaja sobre los knots y
+// los puntos de control homogeneos (x*w,y*w,z*w,w) de una NURBS sin copiarlos.
+// Al armarlo se precalcula la lista de spans no vacios del dominio, y en cada
+// span se evaluan solo las order funciones base que no son nulas, con la
+// recurrencia de Cox-de Boor de abajo hacia arriba (sin recursion); Sample
+// evalua la curva entera de una vez en un arreglo de vertices (x,y,z) listo
+// para subir a un VBO
+
+#define NURBS_EVAL_MAX_ORDER 10
+
+struct NurbsEval {
+	const float *knots = nullptr; // knum = num+order
+	const float *controls = nullptr; // num puntos de 4 floats
+	int num = 0, order = 0;
+	std::vector<int> spans; // k tales que knots[k]<knots[k+1], dentro del dominio [knots[order-1],knots[num]]
+
+	void Setup(const float *knots, const float *controls, int num, int order) {
+		this->knots = knots;
+		this->controls = controls;
+		this->num = num;
+		this->order = order;
+		spans.clear();
+		for (int k=order-1;k<num;k++)
+			if (knots[k]<knots[k+1]) spans.push_back(k);
+	}
+
+	int KnotsCount() const { return num+order; }
+
+	// span (indice k con knots[k]<=u<knots[k+1]) en el que cae u; con
+	// full_range busca en todo el vector de knots y no solo en el dominio de
+	// la curva (para graficar las funciones base); el extremo derecho cae en
+	// el ultimo span no vacio; -1 si u queda afuera
+	int FindSpan(float u, bool full_range=false) const {
+		int first = full_range ? 0 : order-1, last = full_range ? KnotsCount()-1 : num;
+		if (u<knots[first] || u>knots[last] || knots[first]==knots[last]) return -1;
+		if (u==knots[last]) { // el ultimo no vacio
+			int k = last-1;
+			while (knots[k]==knots[last]) --k;
+			return k;
+		}
+		return int(std::upper_bound(knots+first,knots+last+1,u)-knots)-1;
+	}
+
+	// las order funciones base no nulas en u (N[j] es la del pto de control
+	// k-order+1+j) y si se pide, sus derivadas; los indices que se salen del
+	// vector de knots (afuera del dominio) se toman como nulos
+	void BasisFuncs(int k, float u, float *N, float *dN=nullptr) const {
+		int p = order-1, knum = KnotsCount();
+		// tri[j] = N_{k-r+j, r} para el grado r actual
+		float tri[NURBS_EVAL_MAX_ORDER+1];
+		tri[0] = 1;
+		for (int r=1;r<=p;r++) {
+			if (r==p && dN) {
+				for (int j=0;j<=p;j++) {
+					int i = k-p+j; // derivada de N_{i,p} a partir de N_{i,p-1} y N_{i+1,p-1}
+					float d = 0;
+					if (j>0 && i>=0 && knots[i+p]!=knots[i]) d += tri[j-1]/(knots[i+p]-knots[i]);
+					if (j<p && i+p+1<knum && knots[i+p+1]!=knots[i+1]) d -= tri[j]/(knots[i+p+1]-knots[i+1]);
+					dN[j] = p*d;
+				}
+			}
+			float next[NURBS_EVAL_MAX_ORDER+1];
+			for (int j=0;j<=r;j++) {
+				int i = k-r+j; // N_{i,r} = a*N_{i,r-1} + b*N_{i+1,r-1}
+				float v = 0;
+				if (i>=0 && i+r+1<knum) {
+					if (j>0 && knots[i+r]!=knots[i])
+						v += (u-knots[i])/(knots[i+r]-knots[i])*tri[j-1];
+					if (j<r && knots[i+r+1]!=knots[i+1])
+						v += (knots[i+r+1]-u)/(knots[i+r+1]-knots[i+1])*tri[j];
+				}
+				next[j] = v;
+			}
+			std::copy(next,next+r+1,tri);
+		}
+		std::copy(tri,tri+p+1,N);
+		if (dN && p==0) dN[0] = 0;
+	}
+
+	// punto de la curva en u (y su derivada respecto de u si se pide);
+	// rational=false ignora los pesos (la curva con los mismos puntos pero w=1);
+	// u se recorta al dominio, y devuelve false si la curva no esta definida
+	bool Eval(float u, float *p, float *d=nullptr, bool rational=true) const {
+		if (spans.empty()) return false;
+		u = std::min(std::max(u,knots[order-1]),knots[num]);
+		int k = FindSpan(u);
+		if (k<0) return false;
+		EvalInSpan(k,u,p,d,rational);
+		return true;
+	}
+
+	// cuantos puntos necesita cada span para que ningun tramo de la polilinea
+	// mida mas de max_len: la velocidad |C'| en el span esta acotada por la de
+	// los pts de control de la derivada, p*(P_i-P_{i-1})/(knots[i+p]-knots[i]),
+	// y los puntos van equiespaciados en u (con pesos es una aproximacion,
+	// porque se usan los pts cartesianos)
+	int SpanSamples(int k, float max_len) const {
+		int p = order-1;
+		float vmax = 0, prev[2] = {0,0};
+		for (int i=k-p;i<=k;i++) {
+			const float *c = controls+4*i;
+			float w = c[3]!=0 ? c[3] : 1;
+			float x = c[0]/w, y = c[1]/w;
+			if (i>k-p && knots[i+p]>knots[i])
+				vmax = std::max(vmax,p*std::sqrt((x-prev[0])*(x-prev[0])+(y-prev[1])*(y-prev[1]))/(knots[i+p]-knots[i]));
+			prev[0] = x; prev[1] = y;
+		}
+		int n = int(std::ceil(vmax*(knots[k+1]-knots[k])/std::max(max_len,1.f)));
+		return std::min(std::max(n,1),512);
+	}
+
+	// evalua toda la curva en una polilinea (3 floats por vertice, en out)
+	// con segmentos de a lo sumo max_len; firsts (si se da) recibe el primer
+	// vertice de cada span (el span j va de firsts[j] a firsts[j+1] inclusive)
+	void Sample(float max_len, std::vector<float> &out, std::vector<int> *firsts=nullptr, bool rational=true) const {
+		out.clear();
+		if (firsts) firsts->clear();
+		for (int k : spans) {
+			if (firsts) firsts->push_back(out.size()/3);
+			int n = SpanSamples(k,max_len);
+			float u0 = knots[k], du = (knots[k+1]-knots[k])/n;
+			for (int s=0;s<n;s++)
+				AppendPoint(k,u0+s*du,out,rational);
+		}
+		if (!spans.empty()) {
+			if (firsts) firsts->push_back(out.size()/3);
+			AppendPoint(spans.back(),knots[spans.back()+1],out,rational);
+		}
+	}
+
+private:
+	void AppendPoint(int k, float u, std::vector<float> &out, bool rational) const {
+		float p[3];
+		EvalInSpan(k,u,p,nullptr,rational);
+		out.insert(out.end(),p,p+3);
+	}
+
+	void EvalInSpan(int k, float u, float *p, float *d, bool rational) const {
+		float N[NURBS_EVAL_MAX_ORDER], dN[NURBS_EVAL_MAX_ORDER];
+		BasisFuncs(k,u,N,d?dN:nullptr);
+		// A = suma N_i * P_i en coordenadas homogeneas, y A' con las derivadas
+		float A[4] = {0,0,0,0}, dA[4] = {0,0,0,0};
+		for (int j=0;j<order;j++) {
+			const float *c = controls+4*(k-order+1+j);
+			float h[4] = {c[0],c[1],c[2],c[3]};
+			if (!rational) { // el punto cartesiano con peso 1 (w==0 se toma como 1, como en SpanSamples)
+				float w = c[3]!=0 ? c[3] : 1;
+				h[0] /= w; h[1] /= w; h[2] /= w; h[3] = 1;
+			}
+			for (int l=0;l<4;l++) {
+				A[l] += N[j]*h[l];
+				if (d) dA[l] += dN[j]*h[l];
+			}
+		}
+		// C = A/w  =>  C' = (A' - w' C)/w
+		for (int l=0;l<3;l++) {
+			p[l] = A[l]/A[3];
+			if (d) d[l] = (dA[l]-dA[3]*p[l])/A[3];
+		}
+	}
+};
+
+#endif
+
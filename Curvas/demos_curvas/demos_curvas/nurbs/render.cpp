@@ -1,20 +1,16 @@
-#ifdef __APPLE__
-# include <OpenGL/gl.win_h>
-# include <OpenGL/glu.win_h>
-# include <GLUT/glut.win_h>
-#else
-# include <GL/gl.h>
-# include <GL/glu.h>
-# include <GL/glut.h>
-#endif
 #include <cmath>
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <imgui.h>
+#include "Shaders.hpp"
 #include "render.h"
 #include "nurbs.h"
+#include "nurbs_eval.h"
 #include "OSD.hpp"
 
 constexpr int SCALE = 2;
-constexpr int LW_1 = 1*SCALE;
-constexpr int LW_2 = 2*SCALE;
 constexpr int PS_1 = 4*SCALE;
 constexpr int PS_2 = 7*SCALE;
 constexpr int PS_3 = 10*SCALE;
@@ -32,7 +28,7 @@ static float // colores
 	color_new[]={.8f,.6f,.6f}, // nuevo nodo
 	color_texto[]={.3f,0.2f,0.8f}; // osd
 
-extern int knots_nodes[ARRAY_MAX];
+extern std::vector<int> knots_nodes;
 
 extern NURBS nurbs;
 
@@ -58,177 +54,257 @@ extern bool draw_parts;
 extern bool sel_on_curve;
 
 
-static void glColorHSV(float h, float s, float v) {
-	
+// Todo lo de un cuadro se junta en dos arreglos (posiciones en coordenadas
+// homogeneas, que divide la gpu, y colores) que se suben juntos a dos VBOs
+// al final del cuadro; cada primitiva es un tramo de esos arreglos que se
+// dibuja con un glDrawArrays. El perfil core no tiene lineas de mas de un
+// pixel, asi que todas son de 1 (los puntos si mantienen su tamanio)
+struct Batch { GLenum mode; int first, count; float size; };
+static std::vector<float> positions, colors;
+static std::vector<Batch> batches;
+static float current_color[3];
+static Shader *shader = nullptr;
+static GLuint vao = 0, vbos[2] = {0,0};
+static int capacity = 0; // vertices alojados en los VBOs
+
+void render_init() {
+	shader = new Shader("shaders/nurbs");
+	glGenVertexArrays(1,&vao);
+	glGenBuffers(2,vbos);
+	glBindVertexArray(vao);
+	shader->setBuffer("vertexPosition",vbos[0],GL_FLOAT,4);
+	shader->setBuffer("vertexColor",vbos[1],GL_FLOAT,3);
+	glBindVertexArray(0);
+}
+
+void render_free() {
+	glDeleteBuffers(2,vbos);
+	glDeleteVertexArrays(1,&vao);
+	delete shader; shader = nullptr;
+}
+
+static void SetColor(float r, float g, float b) {
+	current_color[0] = r; current_color[1] = g; current_color[2] = b;
+}
+
+static void SetColor(const float *c) {
+	SetColor(c[0],c[1],c[2]);
+}
+
+// empieza una primitiva nueva (size es el tamanio de los puntos)
+static void Begin(GLenum mode, float size=1) {
+	batches.push_back({mode,int(positions.size()/4),0,size});
+}
+
+static void Vertex(float x, float y, float z=0, float w=1) {
+	positions.insert(positions.end(),{x,y,z,w});
+	colors.insert(colors.end(),current_color,current_color+3);
+	++batches.back().count;
+}
+
+static void Vertex(const float *p) {
+	Vertex(p[X],p[Y],p[Z],p[W]);
+}
+
+// sube lo que se junto en el cuadro y lo dibuja todo
+static void Flush() {
+	int n = positions.size()/4;
+	if (n) {
+		if (n>capacity) {
+			capacity = 2*n;
+			for(int k=0;k<2;k++) {
+				glBindBuffer(GL_ARRAY_BUFFER,vbos[k]);
+				glBufferData(GL_ARRAY_BUFFER,capacity*(k?3:4)*sizeof(float),nullptr,GL_DYNAMIC_DRAW);
+			}
+		}
+		glBindBuffer(GL_ARRAY_BUFFER,vbos[0]);
+		glBufferSubData(GL_ARRAY_BUFFER,0,positions.size()*sizeof(float),positions.data());
+		glBindBuffer(GL_ARRAY_BUFFER,vbos[1]);
+		glBufferSubData(GL_ARRAY_BUFFER,0,colors.size()*sizeof(float),colors.data());
+
+		shader->use();
+		shader->setUniform("projectionMatrix",glm::ortho(0.f,float(win_w),float(win_h),0.f,-1.f,1.f));
+		glBindVertexArray(vao);
+		for(const Batch &b : batches) {
+			if (!b.count) continue;
+			if (b.mode==GL_POINTS) glPointSize(b.size);
+			glDrawArrays(b.mode,b.first,b.count);
+		}
+		glBindVertexArray(0);
+	}
+	positions.clear(); colors.clear(); batches.clear();
+}
+
+static void ColorHSV(float h, float s, float v) {
+
 	if(h >= 360.f) h = 0.f; else h /= 60.f;
-	
+
 	int i = (int)h;
 	float f = h - i;
 	float p = v * (1.f - s);
 	float q = v * (1.f - (s * f));
 	float t = v * (1.f - (s * (1.f - f)));
-	
+
 	switch(i) {
-	case 0:  glColor3f(v,t,p); return;
-	case 1:  glColor3f(q,v,p); return;
-	case 2:  glColor3f(p,v,t); return;
-	case 3:  glColor3f(p,q,v); return;
-	case 4:  glColor3f(t,p,v); return;
-	default: glColor3f(v,p,q); return;
+	case 0:  SetColor(v,t,p); return;
+	case 1:  SetColor(q,v,p); return;
+	case 2:  SetColor(p,v,t); return;
+	case 3:  SetColor(p,q,v); return;
+	case 4:  SetColor(t,p,v); return;
+	default: SetColor(v,p,q); return;
 	}
-	
+
 }
 
-static void glColorISV(int i, float s, float v) {
+static void ColorISV(int i, float s, float v) {
 	constexpr float golden_ration = 1.61803398875;
 	float hue = std::fmod(i*360.f/golden_ration,360.f);
-	glColorHSV(hue,s,v);
+	ColorHSV(hue,s,v);
+}
+
+// la curva evaluada en cada cuadro (NurbsEval lee la nurbs sin copiarla)
+static NurbsEval evaluator;
+static std::vector<float> curve_pts;
+
+// la polilinea que devuelve NurbsEval::Sample (x,y,z por vertice)
+static void DrawStrip(const std::vector<float> &pts) {
+	Begin(GL_LINE_STRIP);
+	for (size_t i=0;i+2<pts.size();i+=3)
+		Vertex(pts[i],pts[i+1],pts[i+2]);
 }
 
 static void RenderPolygon(NURBS &nurbs) {
-	glLineWidth(LW_1);
-	glColor3fv(color_cline);
-	glBegin(GL_LINE_STRIP);
+	SetColor(color_cline);
+	Begin(GL_LINE_STRIP);
 	for (int i=0;i<nurbs.num;i++)
-		glVertex4fv(nurbs.controls[i]);
-	glEnd();
+		Vertex(nurbs.controls[i]);
 }
 
+// la misma curva pero con todos los pesos en 1
 static void RenderW1(NURBS &nurbs) {
 	if (!nurbs.WellDefined()) return;
-	int i;
-	for (i=0;i<nurbs.num;i++){
-		float win_w=nurbs.controls[i][W];
-		nurbs.controls[i][X]/=win_w;
-		nurbs.controls[i][Y]/=win_w;
-	}
-	glLineWidth(LW_1);
-	glColor3fv(color_nurbs);
-	static GLUnurbs *renderer = gluNewNurbsRenderer();
-	gluNurbsProperty(renderer, GLU_SAMPLING_TOLERANCE, nurbs.detail);
-	gluBeginCurve(renderer);
-	gluNurbsCurve(renderer, nurbs.knum, nurbs.knots, 4, (float*)nurbs.controls, nurbs.order, GL_MAP1_VERTEX_3);
-	gluEndCurve(renderer);
-	for (i=0;i<nurbs.num;i++){
-		float win_w=nurbs.controls[i][W];
-		nurbs.controls[i][X]*=win_w;
-		nurbs.controls[i][Y]*=win_w;
-	}
-//	gluDeleteNurbsRenderer(renderer); // no porque es static
+	SetColor(color_nurbs);
+	nurbs.SetupEval(evaluator);
+	evaluator.Sample(nurbs.detail,curve_pts,nullptr,false);
+	DrawStrip(curve_pts);
 }
 
-static void RenderCurve(NURBS &nurbs, bool color=true) {
+static void RenderCurve(NURBS &nurbs) {
 	if (!nurbs.WellDefined()) return;
-	// dibujar la curva real
-	glLineWidth(LW_2);
-	if (color) glColor3fv(color_nurbs);
-	static GLUnurbs *renderer = gluNewNurbsRenderer();
-	gluNurbsProperty(renderer, GLU_SAMPLING_TOLERANCE, nurbs.detail);
-	gluBeginCurve(renderer);
-	gluNurbsCurve(renderer, nurbs.knum, nurbs.knots, 4, (float*)nurbs.controls, nurbs.order, GL_MAP1_VERTEX_4);
-	gluEndCurve(renderer);
-//	gluDeleteNurbsRenderer(renderer); // no porque es static
+	// dibujar la curva real (nurbs.detail es el largo maximo de cada segmento, en pixeles)
+	SetColor(color_nurbs);
+	nurbs.SetupEval(evaluator);
+	evaluator.Sample(nurbs.detail,curve_pts);
+	DrawStrip(curve_pts);
 }
+
+// cada tramo (span entre dos knots) de un color, evaluando cada uno como
+// una nurbs aparte que es solo una vista sobre la original
 static void RenderCurveParts(NURBS &nurbs) {
-	for(int i=nurbs.order-1,k=1;i<nurbs.num;i++,++k) { 
-		glColorISV(k,1,.9);
-		NURBS n2(nurbs);
-		int k1 = n2.InsertKnot(nurbs.knots[i],true);
-		for(int j=0;j<k1-n2.order+1;j++) n2.DeleteControl(0);
-		RenderCurve(n2,false);
+	if (!nurbs.WellDefined()) return;
+	for (int i=nurbs.order-1,k=1;i<nurbs.num;i++,++k) {
+		ColorISV(k,1,.9);
+		nurbs.SetupEval(evaluator,i,i);
+		evaluator.Sample(nurbs.detail,curve_pts);
+		DrawStrip(curve_pts);
 	}
 }
 
 static void RenderKnots(NURBS &nurbs) {
 	// dibujar los knot sobre la curva
 	nurbs.CalcKNots();
-	glColor3fv(color_knot);
-	glPointSize(PS_1);
-	glBegin(GL_POINTS);
+	SetColor(color_knot);
+	Begin(GL_POINTS,PS_1);
 	for (int i=nurbs.order;i<nurbs.knum-nurbs.order;i++) {
-		glVertex2iv(nurbs.knots_points[i]);
+		Vertex(nurbs.knots_points[i][X],nurbs.knots_points[i][Y]);
 	}
-	glEnd();
 }
 
 static void RenderPoints(NURBS &nurbs, bool use_colors) {
 	// draw control points
-	glColor3fv(color_cpoint);
-	glPointSize(PS_1);
-	glBegin(GL_POINTS);
+	SetColor(color_cpoint);
+	Begin(GL_POINTS,PS_1);
 	for (int i=0;i<nurbs.num;i++){
-		if (use_colors) glColorISV(i,1,1);
+		if (use_colors) ColorISV(i,1,1);
 		float win_w=nurbs.controls[i][W];
-		if (win_w>0) glVertex4fv(nurbs.controls[i]);
-		else glVertex4f(-nurbs.controls[i][X],-nurbs.controls[i][Y],0,-nurbs.controls[i][W]);
+		if (win_w>0) Vertex(nurbs.controls[i]);
+		else Vertex(-nurbs.controls[i][X],-nurbs.controls[i][Y],0,-nurbs.controls[i][W]);
 	}
-	glEnd();
 }
 
-static float BSplineBasisFunc(float knots[], int i, int k, float t) {
-	if (t<knots[i] || t>knots[i+k]) return 0;
-	if (k==1)
-		return (t>=knots[i] && t<knots[i+1])?1:0;
-	else return 
-		(t-knots[i])/((knots[i+k-1]-knots[i]==0?1:knots[i+k-1]-knots[i]))*BSplineBasisFunc(knots,i,k-1,t)
-		+(knots[i+k]-t)/((knots[i+k]-knots[i+1]==0?1:knots[i+k]-knots[i+1]))*BSplineBasisFunc(knots,i+1,k-1,t);
-};
+// funcion base del pto de control i en t (en todo el vector de knots, no
+// solo en el dominio de la curva)
+static float BSplineBasisFunc(const NurbsEval &ev, int i, float t) {
+	int k = ev.FindSpan(t,true);
+	if (k<0 || i<k-ev.order+1 || i>k) return 0;
+	float N[NURBS_EVAL_MAX_ORDER];
+	ev.BasisFuncs(k,t,N);
+	return N[i-(k-ev.order+1)];
+}
 
 static void RenderBasisFunctions() {
-	
+
+	nurbs.SetupEval(evaluator);
 	auto func_draw_basis = [](int i, float t0, float t1) {
-		glBegin(GL_LINE_STRIP);
+		Begin(GL_LINE_STRIP);
 		float knots_line_len = win_w-MARGIN-MARGIN;
 		int x0 = MARGIN+t0*knots_line_len;
 		int x1 = MARGIN+t1*knots_line_len;
 		float dt = (t1-t0)/(x1-x0), t=t0;
 		for (int x=x0;x<x1;++x,t+=dt) {
-			float y = BSplineBasisFunc(nurbs.knots,i,nurbs.order,t);
-			glVertex2f(x,win_h-MARGIN*2-y*win_h/3);
+			float y = BSplineBasisFunc(evaluator,i,t);
+			Vertex(x,win_h-MARGIN*2-y*win_h/3);
 		}
-		glEnd();			
 	};
-	
-	glColor3fv(color_knot);
+
+	// la del pto seleccionado se dibuja al final, para que quede arriba
+	SetColor(color_knot);
 	for (int i=0;i<nurbs.num;i++) { // por cada pt de control
-		glLineWidth(sel_control==i?LW_2:LW_1);
-		if (!draw_parts) glColorISV(i,.5,1);
+		if (i==sel_control) continue;
+		if (!draw_parts) ColorISV(i,.5,1);
 		func_draw_basis(i,0,1);
 	}
-	
+	if (sel_control>=0 && sel_control<nurbs.num) {
+		if (!draw_parts) ColorISV(sel_control,1,.8);
+		func_draw_basis(sel_control,0,1);
+	}
+
 	if (draw_parts) {
-		glLineWidth(LW_2);
 		for(int k=0;k<nurbs.num-nurbs.order+1;++k) {
 			float t0 = nurbs.knots[k+nurbs.order-1];
 			float t1 = nurbs.knots[k+nurbs.order];
-			glColorISV(k+1,.7,1);			
+			ColorISV(k+1,.7,1);
 			for (int i=0;i<nurbs.num;i++) { // por cada pt de control
 				func_draw_basis(i,t0,t1);
 			}
 		}
 	}
-	
+
 	if (sel_knot!=SEL_NONE) {
-		glColor3fv(color_knot);
-		glBegin(GL_LINES);
+		SetColor(color_knot);
+		Begin(GL_LINES);
 //		sel_knot_u = nurbs.knots[sel_knot];
 //		sel_knot_u = float(sel_x-MARGIN)/knot_line;
-		glVertex2f(sel_x,win_h-MARGIN*2);
-		glVertex2f(sel_x,win_h-MARGIN*2-win_h/3);
-		glEnd();
+		Vertex(sel_x,win_h-MARGIN*2);
+		Vertex(sel_x,win_h-MARGIN*2-win_h/3);
 	}
-	
+
+}
+
+// texto en la ventana (con ImGui, se dibuja despues que todo lo demas)
+static void Text(float x, float y, const char *s) {
+	ImU32 color = ImGui::ColorConvertFloat4ToU32(ImVec4(color_knot[0],color_knot[1],color_knot[2],1.f));
+	// glRasterPos marcaba la linea de base, ImGui ubica el texto por arriba
+	ImGui::GetBackgroundDrawList()->AddText(ImVec2(x,y-ImGui::GetFontSize()),color,s);
 }
-	
 
 
-// callback del display de la ventana de imagenes
+
+// dibuja un cuadro; se llama dentro de un cuadro de ImGui (para el texto)
 void display_cb() {
-	
-	const auto FONT = GLUT_BITMAP_HELVETICA_12;
-	
+
 	glClearColor(color_fondo[0],color_fondo[1],color_fondo[2],1);
-	
+
 	glClear(GL_COLOR_BUFFER_BIT);
 
 	if (offset_x!=0 || offset_y!=0) { // desplazar si esta pendiente un panning
@@ -238,19 +314,19 @@ void display_cb() {
 		offset_x=0;
 		offset_y=0;
 	}
-	
-	
+
+
 	// determinar el u si hay un pto seleccionado
 	float sel_knot_u = -1;
 	if (sel_knot==SEL_NEW) sel_knot_u = float(sel_x-MARGIN)/knot_line;
-	else if (sel_knot!=SEL_NONE) 
+	else if (sel_knot!=SEL_NONE)
 		sel_knot_u = nurbs.knots[sel_knot];
 	if (sel_knot_u<0||sel_knot_u>1) sel_knot_u = -1;
 
 	if (draw_polygon) RenderPolygon(nurbs);
 	if (nurbs.WellDefined()) {
 		if (draw_w1) RenderW1(nurbs);
-		if (draw_parts) RenderCurveParts(nurbs); 
+		if (draw_parts) RenderCurveParts(nurbs);
 		else RenderCurve(nurbs);
 	}
 	if (draw_knots)   RenderKnots(nurbs);
@@ -258,108 +334,105 @@ void display_cb() {
 
 	// marcar el pto de control seleccionado
 	if (sel_control!=SEL_NONE) {
-		glColorISV(sel_control,1,1);
-		glPointSize(PS_2);
+		ColorISV(sel_control,1,1);
 		float* p=nurbs.controls[sel_control];
-		glBegin(GL_POINTS);
-		if (p[W]>0) glVertex4fv(p);
-		else glVertex4f(-p[X],-p[Y],0,-p[W]);
-		glEnd();
+		Begin(GL_POINTS,PS_2);
+		if (p[W]>0) Vertex(p);
+		else Vertex(-p[X],-p[Y],0,-p[W]);
 	}
 
 	if (draw_detail) {
 		// draw detail line
-		glLineWidth(LW_1);
-		glColor3fv(color_detail);
-		glBegin(GL_LINES);
-		glVertex2i(win_w-MARGIN, MARGIN);
-		glVertex2i(win_w-MARGIN,win_h-MARGIN-MARGIN);
-		glEnd();
-		
+		SetColor(color_detail);
+		Begin(GL_LINES);
+		Vertex(win_w-MARGIN, MARGIN);
+		Vertex(win_w-MARGIN,win_h-MARGIN-MARGIN);
+
 		// draw detail point
-		glPointSize(sel_detail?PS_2:PS_1);
-		glBegin(GL_POINTS);
-		glVertex2f(win_w-MARGIN,detail_pos);
-		glEnd();
+		Begin(GL_POINTS,sel_detail?PS_2:PS_1);
+		Vertex(win_w-MARGIN,detail_pos);
 	}
 
 	if (draw_basis) RenderBasisFunctions();
-	
+
 	int kh=win_h-MARGIN;
 	if (draw_kline) {
 		// draw knots line
-		glLineWidth(LW_1);
-		glColor3fv(color_knot);
-		glBegin(GL_LINES);
-		glVertex2i(MARGIN,win_h-MARGIN);
-		glVertex2i(win_w-MARGIN,win_h-MARGIN);
-		glEnd();
-		
-		// draw knots
-		glPointSize(PS_1);
-		glBegin(GL_POINTS);
+		SetColor(color_knot);
+		Begin(GL_LINES);
+		Vertex(MARGIN,win_h-MARGIN);
+		Vertex(win_w-MARGIN,win_h-MARGIN);
+
+		// draw knots (y la multiplicidad de los repetidos)
+		Begin(GL_POINTS,PS_1);
 		float lk=-1;
 		int count=0;
+		char mult[] = "x1";
+		knots_nodes.resize(nurbs.knum);
 		for (int i=1;i<nurbs.knum-1;i++) {
 			if (lk==nurbs.knots[i]) {
 				knots_nodes[i]=knots_nodes[i-1];
 				count++;
 			} else {
 				if (count) {
-					glEnd();
-					glRasterPos2f(MARGIN+knot_line*lk-5,win_h-MARGIN-5);
-					glutBitmapCharacter(FONT, 'x');
-					glutBitmapCharacter(FONT, count+'1');
-					glBegin(GL_POINTS);
+					mult[1] = count+'1';
+					Text(MARGIN+knot_line*lk-5,win_h-MARGIN-5,mult);
 					count=0;
 				}
-				glVertex2i(knots_nodes[i] = int(MARGIN+knot_line*(lk=nurbs.knots[i])),kh);
+				Vertex(knots_nodes[i] = int(MARGIN+knot_line*(lk=nurbs.knots[i])),kh);
 			}
 		}
-		glEnd();
 		if (count) {
-			glRasterPos2f(MARGIN+knot_line*lk-10,win_h-MARGIN-5);
-			glutBitmapCharacter(FONT, 'x');
-			glutBitmapCharacter(FONT, count+'1');
+			mult[1] = count+'1';
+			Text(MARGIN+knot_line*lk-10,win_h-MARGIN-5,mult);
 		}
 	}
 	if (sel_knot_u>=0) { // dibujar el knot seleccionado
-		if (sel_knot==SEL_NEW) glColor3fv(color_new);
-		glPointSize(PS_2);
-		glBegin(GL_POINTS);
+		if (sel_knot==SEL_NEW) SetColor(color_new);
+		Begin(GL_POINTS,PS_2);
 		// en la linea de knots
-		if (draw_kline) glVertex2i(MARGIN+sel_knot_u*(win_w-2*MARGIN),kh);
+		if (draw_kline) Vertex(MARGIN+sel_knot_u*(win_w-2*MARGIN),kh);
 		// en la curva
 		bool sel_knot_u_is_ok = sel_knot_u>=nurbs.knots[nurbs.order-1] && sel_knot_u<=nurbs.knots[nurbs.num];
 		int rep_knots;
-		if (sel_knot_u_is_ok) glVertex4fv(nurbs.FindPoint(sel_knot_u,&rep_knots));
-		glEnd();
-		
+		if (sel_knot_u_is_ok) Vertex(nurbs.FindPoint(sel_knot_u,&rep_knots));
+
+		// la tangente en ese punto
+		float p[3], d[3];
+		nurbs.SetupEval(evaluator);
+		if (sel_knot_u_is_ok && evaluator.Eval(sel_knot_u,p,d)) {
+			float len = std::sqrt(d[X]*d[X]+d[Y]*d[Y]);
+			if (len>0) {
+				constexpr float TANGENT_LEN = 25*SCALE;
+				SetColor(color_detail);
+				Begin(GL_LINES);
+				Vertex(p[X]-d[X]/len*TANGENT_LEN,p[Y]-d[Y]/len*TANGENT_LEN);
+				Vertex(p[X]+d[X]/len*TANGENT_LEN,p[Y]+d[Y]/len*TANGENT_LEN);
+			}
+		}
+
 		// segmentos de decasteljau/bloosoming
 		if (decasteljau_level && sel_knot_u_is_ok) {
 			decasteljau_level = decasteljau_level%(nurbs.order-1);
-			glLineWidth(LW_1); glBegin(GL_LINES);
-			for(int i=1;i<=decasteljau_level;i++) { 
-				glColorISV(i+1,1,.75);
-				for(int j=i;j<nurbs.order-1-rep_knots;j++) { 
-					glVertex2fv(nurbs.aux_c[i][j]);
-					glVertex2fv(nurbs.aux_c[i][j+1]);
+			Begin(GL_LINES);
+			for(int i=1;i<=decasteljau_level;i++) {
+				ColorISV(i+1,1,.75);
+				for(int j=i;j<nurbs.order-1-rep_knots;j++) {
+					Vertex(nurbs.aux_c[i][j][X],nurbs.aux_c[i][j][Y]);
+					Vertex(nurbs.aux_c[i][j+1][X],nurbs.aux_c[i][j+1][Y]);
 				}
 			}
-			glEnd();
-			glPointSize(PS_1); glBegin(GL_POINTS);
-			for(int i=1;i<=decasteljau_level;i++) { 
-				glColorISV(i+1,1,.75);
-				for(int j=i;j<nurbs.order-rep_knots;j++) { 
-					glVertex2fv(nurbs.aux_c[i][j]);
+			Begin(GL_POINTS,PS_1);
+			for(int i=1;i<=decasteljau_level;i++) {
+				ColorISV(i+1,1,.75);
+				for(int j=i;j<nurbs.order-rep_knots;j++) {
+					Vertex(nurbs.aux_c[i][j][X],nurbs.aux_c[i][j][Y]);
 				}
 			}
-			glEnd();
 		}
 	}
-	
-	glColor3fv(color_texto);
-	OSD.Render(win_w,win_h);
-	
-	glutSwapBuffers();
+
+	Flush();
+
+	OSD.Render(win_w,win_h,color_texto);
 }
@@ -1,6 +1,10 @@
 #ifndef RENDER_H
 #define RENDER_H
 
+// el shader y los buffers con los que se dibuja (necesitan el contexto)
+void render_init();
+void render_free();
+
 void display_cb();
 
 #endif
@@ -0,0 +1,3 @@
+#include <glad/glad.h>
+#include "testsNurbs.h"
+PruebaNurbs probar_nurbs;
@@ -0,0 +1,3 @@
+#include <glad/glad.h>
+#include "testsNurbsEval.h"
+PruebaNurbsEval probar_nurbs_eval;
@@ -0,0 +1,89 @@
+#ifndef TESTSNURBS_H
+#define TESTSNURBS_H
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "nurbs.h"
+#include "nurbs_eval.h"
+
+#define nurbs_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de NURBS:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// NURBS de tamanio variable: mas pts de control que el viejo limite de 1000,
+// vistas de un tramo (SetupEval con from/to) que evaluan lo mismo que la curva
+// entera sin copiar nada, insercion de knots que no cambia la curva, y
+// FindPoint fuera del dominio recortado al extremo
+struct PruebaNurbs {
+	static bool iguales(const float *a, const float *b, float tol=1e-2f) {
+		return std::fabs(a[X]-b[X])<tol && std::fabs(a[Y]-b[Y])<tol;
+	}
+	
+	PruebaNurbs() {
+		NURBS nb;
+		const int n = 3000;
+		for (int i=0;i<n;i++) {
+			nb.AddControlPoint(i%100*8.f,i/100*20.f+(i%7)*3.f);
+			nb.controls[i][X] *= 2; nb.controls[i][Y] *= 2; nb.controls[i][W] = 2; // mismo punto, peso 2
+		}
+		nb.ResetKnots(KD_UNIFORM);
+		nurbs_assert(nb.num==n && nb.knum==n+4 && int(nb.knots.size())==nb.knum && nb.WellDefined());
+		NurbsEval ev; nb.SetupEval(ev);
+		nurbs_assert(int(ev.spans.size())==n-3);
+		
+		// cada span visto solo: el mismo dominio y los mismos puntos, apuntando
+		// a los datos de la curva
+		for (int i=nb.order-1;i<nb.num;i+=97) {
+			NurbsEval parte; nb.SetupEval(parte,i,i);
+			nurbs_assert(parte.spans.size()==1);
+			int k = parte.spans[0];
+			nurbs_assert(parte.knots[k]==nb.knots[i] && parte.knots[k+1]==nb.knots[i+1]);
+			nurbs_assert(parte.controls>=&nb.controls[0][0] && parte.controls<=&nb.controls[n-1][0]);
+			for (int s=0;s<=10;s++) {
+				float u = nb.knots[i]+(nb.knots[i+1]-nb.knots[i])*s/10, p[3], q[3];
+				nurbs_assert(parte.Eval(u,p) && ev.Eval(u,q) && iguales(p,q,1e-3f));
+			}
+		}
+		// y varios juntos
+		NurbsEval tramo; nb.SetupEval(tramo,100,180);
+		nurbs_assert(tramo.spans.size()==81);
+		float p[3], q[3];
+		nurbs_assert(tramo.Eval(nb.knots[140]+1e-5f,p) && ev.Eval(nb.knots[140]+1e-5f,q) && iguales(p,q,1e-3f));
+		
+		// insertar knots (una vez, o hasta interpolar) no cambia la curva
+		NURBS chica;
+		for (int i=0;i<8;i++) chica.AddControlPoint(100*i,(i%2)*200);
+		chica.controls[3][X] *= 3; chica.controls[3][Y] *= 3; chica.controls[3][W] = 3;
+		chica.ResetKnots(KD_BEZIER_BOUNDARY);
+		NURBS antes = chica;
+		int num = chica.num;
+		chica.InsertKnot(0.3f);
+		nurbs_assert(chica.num==num+1 && chica.knum==chica.num+chica.order);
+		int k = chica.InsertKnot(0.61f,true);
+		NurbsEval ea, eb; antes.SetupEval(ea); chica.SetupEval(eb);
+		for (int s=0;s<=50;s++) {
+			float u = s/50.f;
+			nurbs_assert(ea.Eval(u,p) && eb.Eval(u,q) && iguales(p,q));
+		}
+		// al interpolar, la curva pasa por el pto de control agregado
+		const float *c = chica.controls[k-chica.order+1];
+		ea.Eval(0.61f,p);
+		float cc[2] = {c[X]/c[W],c[Y]/c[W]};
+		nurbs_assert(iguales(p,cc));
+		
+		// FindPoint fuera del dominio da el extremo
+		float *a = antes.FindPoint(-5.f);
+		float a0[2] = {a[X]/a[W],a[Y]/a[W]};
+		float b0[2] = {0,0};
+		nurbs_assert(iguales(a0,b0,1e-4f));
+		float *b = antes.FindPoint(1.f);
+		nurbs_assert(std::fabs(b[X]/b[W]-700)<1e-2f && std::fabs(b[Y]/b[W]-200)<1e-2f);
+		b = antes.FindPoint(7.f);
+		nurbs_assert(std::fabs(b[X]/b[W]-700)<1e-2f && std::fabs(b[Y]/b[W]-200)<1e-2f);
+	}
+};
+
+#endif
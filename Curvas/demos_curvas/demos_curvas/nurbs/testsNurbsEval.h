@@ -0,0 +1,117 @@
+#ifndef TESTSNURBSEVAL_H
+#define TESTSNURBSEVAL_H
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "nurbs.h"
+#include "nurbs_eval.h"
+
+#define eval_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de NurbsEval:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// NurbsEval contra las implementaciones anteriores: las funciones base contra
+// la recursion de Cox-de Boor que usaba render.cpp, los puntos contra la suma
+// de esas bases por los pts de control y contra FindPoint (de Boor), y las
+// derivadas contra diferencias finitas; con knots uniformes, interpolando los
+// extremos, por tramos de Bezier y con knots repetidos, de orden 2 a 7 y pesos
+// distintos de 1
+struct PruebaNurbsEval {
+	// la de render.cpp antes de NurbsEval (N_{i,k}, k = orden)
+	static float BaseRecursiva(const float *knots, int i, int k, float t) {
+		if (t<knots[i] || t>knots[i+k]) return 0;
+		if (k==1)
+			return (t>=knots[i] && t<knots[i+1])?1:0;
+		else return
+			(t-knots[i])/((knots[i+k-1]-knots[i]==0?1:knots[i+k-1]-knots[i]))*BaseRecursiva(knots,i,k-1,t)
+			+(knots[i+k]-t)/((knots[i+k]-knots[i+1]==0?1:knots[i+k]-knots[i+1]))*BaseRecursiva(knots,i+1,k-1,t);
+	}
+	
+	PruebaNurbsEval() {
+		std::mt19937 rng(1);
+		std::uniform_real_distribution<float> U(0,1);
+		NURBS nb;
+		for (int caso=0;caso<120;caso++) {
+			nb.Clear();
+			int n = 4+rng()%10;
+			for (int i=0;i<n;i++) {
+				nb.AddControlPoint(U(rng)*800,U(rng)*600);
+				float w = 0.3f+2*U(rng);
+				nb.controls[i][X] *= w; nb.controls[i][Y] *= w; nb.controls[i][W] = w;
+			}
+			nb.SetDegree(1+rng()%std::min(6,n-1));
+			nb.ResetKnots(caso%3);
+			if (caso%5==0) { nb.InsertKnot(0.37f); nb.InsertKnot(0.37f); }
+			if (!nb.WellDefined()) continue;
+			NurbsEval ev; nb.SetupEval(ev);
+			const float *kn = nb.knots.data();
+			float u0 = kn[nb.order-1], u1 = kn[nb.num];
+			
+			// funciones base en todo el vector de knots (como las grafica render.cpp)
+			for (int s=0;s<200;s++) {
+				float u = s/200.f+0.0013f;
+				int k = ev.FindSpan(u,true);
+				if (k<0) continue;
+				eval_assert(kn[k]<=u && u<kn[k+1]);
+				float N[NURBS_EVAL_MAX_ORDER];
+				ev.BasisFuncs(k,u,N);
+				for (int i=0;i<nb.num;i++) {
+					float m = (i>=k-nb.order+1 && i<=k) ? N[i-(k-nb.order+1)] : 0;
+					eval_assert(std::fabs(BaseRecursiva(kn,i,nb.order,u)-m)<1e-4f);
+				}
+			}
+			
+			// puntos y derivadas en el dominio (sin los extremos, donde la
+			// recursion con intervalos semiabiertos da 0)
+			for (int s=1;s<200;s++) {
+				float u = u0+(u1-u0)*s/200.f, p[3], d[3];
+				eval_assert(ev.Eval(u,p,d));
+				float h[4] = {0,0,0,0};
+				for (int i=0;i<nb.num;i++) {
+					float b = BaseRecursiva(kn,i,nb.order,u);
+					for (int l=0;l<4;l++) h[l] += b*nb.controls[i][l];
+				}
+				float tol = 1e-3f*(1+std::fabs(p[X])+std::fabs(p[Y]));
+				eval_assert(std::fabs(h[X]/h[W]-p[X])<tol && std::fabs(h[Y]/h[W]-p[Y])<tol);
+				float *q = nb.FindPoint(u);
+				eval_assert(std::fabs(q[X]/q[W]-p[X])<tol && std::fabs(q[Y]/q[W]-p[Y])<tol);
+				float e = 1e-3f, pa[3], pb[3];
+				if (u-e>u0 && u+e<u1 && ev.FindSpan(u-e)==ev.FindSpan(u+e)) {
+					ev.Eval(u-e,pa); ev.Eval(u+e,pb);
+					for (int l=0;l<2;l++)
+						eval_assert(std::fabs((pb[l]-pa[l])/(2*e)-d[l])<2e-2f*(1+std::hypot(d[X],d[Y])));
+				}
+			}
+			
+			// la polilinea: empieza y termina en los extremos, un vertice de
+			// inicio por span y sin tramos mas largos que lo pedido (sin pesos,
+			// la curva es mas corta que su poligono de control)
+			std::vector<float> v;
+			std::vector<int> firsts;
+			ev.Sample(10,v,&firsts,false);
+			eval_assert(firsts.size()==ev.spans.size()+1 && firsts.back()*3+3==int(v.size()));
+			float a[3], b[3];
+			ev.Eval(u0,a,nullptr,false); ev.Eval(u1,b,nullptr,false);
+			eval_assert(v[0]==a[0] && v[1]==a[1] && v[v.size()-3]==b[0] && v[v.size()-2]==b[1]);
+			for (size_t i=3;i<v.size();i+=3)
+				eval_assert(std::hypot(v[i]-v[i-3],v[i+1]-v[i-2])<=10.01f);
+		}
+		
+		// fuera del dominio se recorta al extremo
+		nb.Clear();
+		for (int i=0;i<5;i++) nb.AddControlPoint(100*i,50*(i%2));
+		nb.ResetKnots(KD_BEZIER_BOUNDARY);
+		NurbsEval ev; nb.SetupEval(ev);
+		float p[3], q[3];
+		eval_assert(ev.Eval(-1,p) && ev.Eval(0,q) && p[X]==q[X] && p[Y]==q[Y]);
+		eval_assert(std::fabs(q[X]-0)<1e-4f && std::fabs(q[Y]-0)<1e-4f);
+		eval_assert(ev.Eval(2,p) && std::fabs(p[X]-400)<1e-3f && std::fabs(p[Y]-0)<1e-3f);
+		eval_assert(ev.FindSpan(-1)==-1 && ev.FindSpan(1)==nb.num-1);
+	}
+};
+
+#endif
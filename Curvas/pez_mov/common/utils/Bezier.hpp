@@ -1,5 +1,6 @@
 #ifndef BEZIER_HPP
 #define BEZIER_HPP
+#include <algorithm>
 #include <initializer_list>
 #include <iterator>
 #include <glm/glm.hpp>
@@ -42,10 +43,122 @@ public:
 		deriv = (x[1]-x[0])*float(DEGREE);
 		return Decast<VEC,1>(x,t);
 	}
+	// evalua la curva en los n parametros ts (out[i] = at(ts[i]))
+	void evalMany(const float *ts, int n, VEC *out) const;
+	// evalua la curva en n parametros equiespaciados (t = i/(n-1))
+	void evalUniform(int n, VEC *out) const;
+	// coeficientes de la curva en la base de potencias: at(t) = sum a[j]*t^j
+	void powerCoefs(VEC a[DEGREE+1]) const;
+	// parte la curva en t en dos del mismo grado (left: [0,t], right: [t,1])
+	void split(float t, Bezier &left, Bezier &right) const {
+		VEC x[DEGREE+1];
+		std::copy(p,p+DEGREE+1,x);
+		for(int j=0;j<=DEGREE;++j) {
+			left.p[j] = x[0]; right.p[DEGREE-j] = x[DEGREE-j];
+			for(int i=0;i<DEGREE-j;++i) x[i] = x[i]*(1-t)+x[i+1]*t;
+		}
+	}
 	int degree() const { return DEGREE; }
 	VEC *data() { return p; }
 	const VEC *data() const { return p; }
 	const int size() const { return DEGREE+1; }
 };
 
+// a[j] = C(D,j) * (diferencia j-esima de los puntos de control en p[0])
+template<typename VEC, int DEGREE>
+void Bezier<VEC,DEGREE>::powerCoefs(VEC a[DEGREE+1]) const {
+	VEC d[DEGREE+1];
+	std::copy(p,p+DEGREE+1,d);
+	float comb = 1.f;
+	for(int j=0;j<=DEGREE;++j) {
+		a[j] = d[0]*comb;
+		for(int i=0;i<DEGREE-j;++i) d[i] = d[i+1]-d[i];
+		comb = comb*(DEGREE-j)/(j+1);
+	}
+}
+
+// En lugar de de Casteljau para cada t (que con la recursion de DecastImpl
+// repite los mismos terminos, O(2^D)) pasa la curva una vez a la base de
+// potencias y evalua por Horner (D productos y sumas por componente). Los
+// parametros se procesan en bloques y cada componente por separado, con los
+// acumuladores en un arreglo de floats, asi el lazo interno es el mismo para
+// todos los t del bloque y el compilador lo vectoriza
+template<typename VEC, int DEGREE>
+void Bezier<VEC,DEGREE>::evalMany(const float *ts, int n, VEC *out) const {
+	constexpr int L = VEC::length(), BLOQUE = 64;
+	VEC a[DEGREE+1];
+	powerCoefs(a);
+	float c[L][DEGREE+1];
+	for(int k=0;k<L;++k) 
+		for(int j=0;j<=DEGREE;++j) 
+			c[k][j] = a[j][k];
+	float acc[BLOQUE];
+	for(int i0=0;i0<n;i0+=BLOQUE) {
+		int m = std::min(BLOQUE,n-i0);
+		const float *t = ts+i0;
+		for(int k=0;k<L;++k) {
+			for(int i=0;i<m;++i) acc[i] = c[k][DEGREE];
+			for(int j=DEGREE-1;j>=0;--j) 
+				for(int i=0;i<m;++i) 
+					acc[i] = acc[i]*t[i]+c[k][j];
+			for(int i=0;i<m;++i) out[i0+i][k] = acc[i];
+		}
+	}
+}
+
+// Diferencias hacia adelante: con paso fijo, la diferencia D-esima de un
+// polinomio de grado D es constante, asi que cada muestra sale de la anterior
+// con D sumas. La tabla de diferencias no se saca restando valores (que
+// difieren en muy poco y se pierde toda la precision), sino de la base de
+// potencias: si f(t0+h*s) = sum b[k]*s^k, la diferencia j-esima en s=0 es
+// j! * sum S(k,j)*b[k] (S: numeros de Stirling de segunda especie). Como el
+// error se acumula en cada suma, la tabla se arma de nuevo cada TRAMO
+// muestras; y como cada muestra depende de la anterior, para vectorizar se
+// avanzan CARRILES tramos a la vez, uno en cada elemento de los arreglos
+template<typename VEC, int DEGREE>
+void Bezier<VEC,DEGREE>::evalUniform(int n, VEC *out) const {
+	if (n<=0) return;
+	if (n==1) { out[0] = p[0]; return; }
+	constexpr int L = VEC::length(), TRAMO = 32, CARRILES = 8;
+	VEC a[DEGREE+1], b[DEGREE+1];
+	powerCoefs(a);
+	float stirling[DEGREE+1][DEGREE+1] = {}; // por j! (diferencias de s^k en 0)
+	stirling[0][0] = 1.f;
+	for(int k=1;k<=DEGREE;++k) 
+		for(int j=1;j<=k;++j) 
+			stirling[k][j] = j*(stirling[k-1][j]+stirling[k-1][j-1]);
+	float h = 1.f/(n-1);
+	float d[L][DEGREE+1][CARRILES];
+	for(int i0=0;i0<n;i0+=TRAMO*CARRILES) {
+		for(int c=0;c<CARRILES;++c) { 
+			// b[k] = h^k * (derivada k-esima en t0)/k!, por Horner desde a
+			float t0 = (i0+c*TRAMO)*h;
+			std::copy(a,a+DEGREE+1,b);
+			for(int k=0;k<=DEGREE;++k) 
+				for(int l=DEGREE-1;l>=k;--l) 
+					b[l] = b[l]+b[l+1]*t0;
+			float hk = 1.f;
+			for(int k=0;k<=DEGREE;++k,hk*=h) b[k] = b[k]*hk;
+			for(int j=0;j<=DEGREE;++j) { 
+				VEC dj = b[j]*stirling[j][j];
+				for(int k=j+1;k<=DEGREE;++k) dj = dj+b[k]*stirling[k][j];
+				for(int k=0;k<L;++k) d[k][j][c] = dj[k];
+			}
+		}
+		int m = std::min(TRAMO*CARRILES,n-i0);
+		for(int k=0;k<L;++k) {
+			for(int i=0;i<TRAMO;++i) {
+				for(int c=0;c<CARRILES;++c) { 
+					int is = c*TRAMO+i;
+					if (is<m) out[i0+is][k] = d[k][0][c];
+				}
+				for(int j=0;j<DEGREE;++j) 
+					for(int c=0;c<CARRILES;++c) 
+						d[k][j][c] += d[k][j+1][c];
+			}
+		}
+	}
+	out[0] = p[0]; out[n-1] = p[DEGREE]; // los extremos exactos
+}
+
 #endif
@@ -0,0 +1,87 @@
+#ifndef BEZIERPATCH_HPP
+#define BEZIERPATCH_HPP
+#include <vector>
+#include <glm/glm.hpp>
+#include "Bezier.hpp"
+
+// Parche de Bezier producto tensorial: (DEGREE+1)x(DEGREE+1) puntos de
+// control, p[i][j] con i en la direccion de u y j en la de v. Se evalua con
+// las curvas de Bezier: cada fila i es una curva en v, se evaluan todas en el
+// mismo v, y esos DEGREE+1 puntos son los de control de la curva en u
+template<typename VEC=glm::vec3, int DEGREE=3>
+class BezierPatch {
+	static_assert(DEGREE>=1,"a patch needs at least degree 1");
+	VEC p[DEGREE+1][DEGREE+1];
+public:
+	BezierPatch() = default;
+	VEC *operator[](int i) { return p[i]; }
+	const VEC *operator[](int i) const { return p[i]; }
+
+	// la curva en v de la fila i (para i=0 o DEGREE, el borde u=0 o u=1)
+	Bezier<VEC,DEGREE> row(int i) const {
+		Bezier<VEC,DEGREE> b;
+		for(int j=0;j<=DEGREE;++j) b[j] = p[i][j];
+		return b;
+	}
+	// la curva en u de la columna j (para j=0 o DEGREE, el borde v=0 o v=1)
+	Bezier<VEC,DEGREE> column(int j) const {
+		Bezier<VEC,DEGREE> b;
+		for(int i=0;i<=DEGREE;++i) b[i] = p[i][j];
+		return b;
+	}
+
+	VEC at(float u, float v) const {
+		Bezier<VEC,DEGREE> c;
+		for(int i=0;i<=DEGREE;++i) c[i] = row(i).at(v);
+		return c.at(u);
+	}
+	// con las derivadas parciales (la normal es cross(du,dv))
+	VEC at(float u, float v, VEC &du, VEC &dv) const {
+		Bezier<VEC,DEGREE> c, cv;
+		for(int i=0;i<=DEGREE;++i) c[i] = row(i).at(v,cv[i]);
+		dv = cv.at(u);
+		return c.at(u,du);
+	}
+
+	// evalua en una grilla de nu x nv parametros equiespaciados:
+	// pos[a*nv+b] = at(a/(nu-1),b/(nv-1)), y si se piden, las derivadas
+	void evalGrid(int nu, int nv, VEC *pos, VEC *du=nullptr, VEC *dv=nullptr) const;
+
+	int degree() const { return DEGREE; }
+};
+
+// Primero cada fila en los nv valores de v (evalUniform), y despues, para
+// cada v, la curva en u que forman esas filas en los nu valores de u; las
+// derivadas salen de las curvas de grado DEGREE-1 de las diferencias de los
+// puntos de control (en u de la curva de cada v, en v de cada fila)
+template<typename VEC, int DEGREE>
+void BezierPatch<VEC,DEGREE>::evalGrid(int nu, int nv, VEC *pos, VEC *du, VEC *dv) const {
+	if (nu<=0 or nv<=0) return;
+	std::vector<VEC> rows((DEGREE+1)*nv), rows_dv(dv ? (DEGREE+1)*nv : 0), col(nu);
+	for(int i=0;i<=DEGREE;++i) {
+		row(i).evalUniform(nv,rows.data()+i*nv);
+		if (not dv) continue;
+		Bezier<VEC,DEGREE-1> d;
+		for(int j=0;j<DEGREE;++j) d[j] = (p[i][j+1]-p[i][j])*float(DEGREE);
+		d.evalUniform(nv,rows_dv.data()+i*nv);
+	}
+	for(int b=0;b<nv;++b) {
+		Bezier<VEC,DEGREE> c;
+		for(int i=0;i<=DEGREE;++i) c[i] = rows[i*nv+b];
+		c.evalUniform(nu,col.data());
+		for(int a=0;a<nu;++a) pos[a*nv+b] = col[a];
+		if (du) {
+			Bezier<VEC,DEGREE-1> d;
+			for(int i=0;i<DEGREE;++i) d[i] = (c[i+1]-c[i])*float(DEGREE);
+			d.evalUniform(nu,col.data());
+			for(int a=0;a<nu;++a) du[a*nv+b] = col[a];
+		}
+		if (dv) {
+			for(int i=0;i<=DEGREE;++i) c[i] = rows_dv[i*nv+b];
+			c.evalUniform(nu,col.data());
+			for(int a=0;a<nu;++a) dv[a*nv+b] = col[a];
+		}
+	}
+}
+
+#endif
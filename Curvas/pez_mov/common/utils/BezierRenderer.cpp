@@ -1,15 +1,12 @@
 #include "BezierRenderer.hpp"
 #include "Debug.hpp"
 
-BezierRenderer::BezierRenderer(int nsamples) : shader("shaders/curve") { 
+BezierRenderer::BezierRenderer(float tolerance) : shader("shaders/curve"), tolerance(tolerance) { 
 	glGenVertexArrays(1, &VAO);
 	glBindVertexArray(VAO);
 	
-	v_curve.resize(nsamples);
 	v_poly.resize(4);
 	glGenBuffers(2, VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[0]);
-	glBufferData(GL_ARRAY_BUFFER, v_curve.size() * sizeof(glm::vec3), v_curve.data(), GL_DYNAMIC_DRAW);  
 	glBindBuffer(GL_ARRAY_BUFFER, VBO[1]);
 	glBufferData(GL_ARRAY_BUFFER, 4*sizeof(glm::vec3), v_poly.data(), GL_DYNAMIC_DRAW);  
 }
@@ -46,6 +43,6 @@ void BezierRenderer::drawCurve() {
 	glVertexAttribPointer(loc_pos, 3, GL_FLOAT, GL_FALSE, 0, 0);
 	glEnableVertexAttribArray(loc_pos);
 	shader.setUniform("color",color_curve);
-	glDrawArrays(GL_POINTS, 0,v_curve.size());
+	glDrawArrays(GL_LINE_STRIP, 0,v_curve.size());
 	glBindVertexArray(0);
 }
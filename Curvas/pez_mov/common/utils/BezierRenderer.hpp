@@ -2,10 +2,13 @@
 #define BEZIERRENDERER_HPP
 #include <glad/glad.h>
 #include "Shaders.hpp"
+#include "Callbacks.hpp"
+#include "CurveFlattening.hpp"
 
 class BezierRenderer {
 public:
-	BezierRenderer(int nsamples=100);
+	// tolerance: cuanto puede alejarse (en pixeles) la polilinea de la curva
+	BezierRenderer(float tolerance=0.5f);
 	~BezierRenderer();
 	Shader &getShader();
 	template<typename Bezier>
@@ -15,6 +18,8 @@ public:
 private:
 	Shader shader;
 	GLuint VAO=0, VBO[2]={0,0};
+	float tolerance;
+	int curve_capacity = 0; // vertices alojados en VBO[0]
 	std::vector<glm::vec3> v_curve, v_poly;
 	glm::vec3 color_curve = {1.f, 1.f, 1.f};
 	glm::vec3 color_poly = {.0f, .0f, .0f};
@@ -24,10 +29,15 @@ private:
 
 template<typename Bezier>
 void BezierRenderer::update(Bezier &b) {
-	double n = double(v_curve.size())-1;
-	for(size_t i=0;i<v_curve.size();++i)
-		v_curve[i] = b.at(double(i)/n);
+	auto ms = common_callbacks::getMatrixes();
+	CurveFlattening flattening(ms[2]*ms[1]*ms[0],glm::vec2(win_width,win_height),tolerance);
+	v_curve.clear();
+	flattening.flatten(b,v_curve);
 	glBindBuffer(GL_ARRAY_BUFFER,VBO[0]);
+	if (static_cast<int>(v_curve.size())>curve_capacity) {
+		curve_capacity = v_curve.size()*2;
+		glBufferData(GL_ARRAY_BUFFER, curve_capacity * sizeof(glm::vec3), nullptr, GL_DYNAMIC_DRAW);
+	}
 	glBufferSubData(GL_ARRAY_BUFFER, 0, v_curve.size() * sizeof(glm::vec3), v_curve.data());
 	v_poly[0] = b[0];
 	v_poly[1] = b[1];
@@ -0,0 +1,87 @@
+#ifndef CURVEFLATTENING_HPP
+#define CURVEFLATTENING_HPP
+#include <algorithm>
+#include <vector>
+#include <glm/glm.hpp>
+
+// Aproxima curvas de Bezier con polilineas, con el detalle que hace falta en
+// pantalla: cada tramo se parte a la mitad (de Casteljau) mientras alguno de
+// sus puntos de control interiores quede a mas de tolerancia pixeles del
+// segmento entre sus extremos (como la curva esta dentro de la capsula convexa
+// de sus puntos de control, tampoco se aleja mas que eso); asi un tramo recto
+// son dos vertices y uno con mucha curvatura (o muy cerca de la camara) se
+// parte lo que haga falta
+class CurveFlattening {
+public:
+	// mvp: matriz de proyeccion*vista*modelo; viewport: tamanio en pixeles
+	CurveFlattening(const glm::mat4 &mvp, glm::vec2 viewport, float tolerance=0.5f)
+		: mvp(mvp), half_viewport(viewport*.5f), tolerance(tolerance) {}
+	
+	// agrega a out los vertices de la polilinea (el primero solo si out no
+	// termina ya en el, asi varios tramos encadenados forman un solo line strip)
+	template<typename Bezier>
+	void flatten(const Bezier &b, std::vector<glm::vec3> &out) const {
+		if (out.empty() or out.back()!=b[0]) out.push_back(b[0]);
+		subdivide(b,out,0);
+	}
+	
+	// idem para todas las piezas de una spline (o cualquier lista de Beziers)
+	template<typename Pieces>
+	void flattenAll(const Pieces &pieces, std::vector<glm::vec3> &out) const {
+		for(const auto &b : pieces) flatten(b,out);
+	}
+	
+	static constexpr int max_depth = 12; // a lo sumo 2^12 segmentos por tramo
+	
+private:
+	glm::mat4 mvp;
+	glm::vec2 half_viewport;
+	float tolerance;
+	
+	// coords en pixeles; false si queda detras de la camara
+	bool toScreen(const glm::vec3 &p, glm::vec2 &s) const {
+		glm::vec4 c = mvp*glm::vec4(p,1.f);
+		if (c.w<=1e-6f) return false;
+		s = (glm::vec2(c.x,c.y)/c.w+1.f)*half_viewport;
+		return true;
+	}
+	
+	// un tramo con todos sus puntos de control detras de la camara no se ve (w
+	// es afin, asi que la curva tambien queda detras) y se toma como plano; si
+	// solo algunos lo estan se sigue partiendo, pero en cada nivel solo sigue la
+	// mitad que cruza el plano de la camara, asi que agrega O(max_depth) vertices
+	template<typename Bezier>
+	bool isFlat(const Bezier &b) const {
+		int d = b.degree();
+		bool behind = true;
+		for(int i=0;i<=d and behind;++i) 
+			behind = (mvp*glm::vec4(b[i],1.f)).w<=1e-6f;
+		if (behind) return true;
+		glm::vec2 a, c, q;
+		if (not toScreen(b[0],a) or not toScreen(b[d],c)) return false;
+		glm::vec2 ac = c-a;
+		float l2 = glm::dot(ac,ac), tol2 = tolerance*tolerance;
+		for(int i=1;i<d;++i) { 
+			if (not toScreen(b[i],q)) return false;
+			// distancia al segmento (no a la recta, por si el tramo da la vuelta)
+			float u = l2>0.f ? std::min(1.f,std::max(0.f,glm::dot(q-a,ac)/l2)) : 0.f;
+			glm::vec2 e = q-(a+ac*u);
+			if (glm::dot(e,e)>tol2) return false;
+		}
+		return true;
+	}
+	
+	template<typename Bezier>
+	void subdivide(const Bezier &b, std::vector<glm::vec3> &out, int depth) const {
+		if (depth>=max_depth or isFlat(b)) {
+			out.push_back(b[b.degree()]);
+			return;
+		}
+		Bezier left, right;
+		b.split(.5f,left,right);
+		subdivide(left,out,depth+1);
+		subdivide(right,out,depth+1);
+	}
+};
+
+#endif
@@ -60,6 +60,13 @@ void GeometryRenderer::draw() const {
 	glBindVertexArray(0);
 }
 
+void GeometryRenderer::drawInstanced(int instances) const {
+	glBindVertexArray(VAO);
+	if (EBO) glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, 0, instances);
+	else glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+	glBindVertexArray(0);
+}
+
 void GeometryRenderer::freeResources() {
 	if (VAO==0) return;
 	if (VBO_pos) glDeleteBuffers(1,&VBO_pos);
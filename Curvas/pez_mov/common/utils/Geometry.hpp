@@ -22,6 +22,7 @@ public:
 	GeometryRenderer(GeometryRenderer &&geo);
 	GeometryRenderer &operator=(GeometryRenderer &&geo);
 	void draw() const;
+	void drawInstanced(int instances) const;
 	GLuint vertexArray() const { return VAO; }
 	GLuint positionsVBO() const { return VBO_pos; }
 	GLuint normalsVBO() const { return VBO_norms; }
@@ -0,0 +1,198 @@
+#ifndef SURFACETESSELLATOR_HPP
+#define SURFACETESSELLATOR_HPP
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Geometry.hpp"
+
+// Arma una malla de triangulos (Geometry, para GeometryRenderer) a partir de
+// los parches de Bezier de una superficie, con el detalle que hace falta en
+// pantalla. Cada parche se evalua en una grilla de 2^nivel x 2^nivel celdas,
+// con el nivel elegido para que la distancia (en pixeles) entre la grilla y la
+// superficie no pase de tolerancia: para una Bezier de grado D en n tramos es
+// a lo sumo D(D-1)/8 * M/n^2, con M la mayor diferencia segunda de sus puntos
+// de control (en pantalla). La grilla de cada parche se guarda y solo se
+// vuelve a evaluar si cambia su version (ver BSplineSurface) o su nivel.
+// Para que no queden grietas entre parches vecinos con distinto nivel, cada
+// borde tiene su propio nivel (que sale solo de la curva del borde, asi los
+// dos parches que lo comparten calculan el mismo) y sus vertices se toman de
+// esa curva evaluada con ese nivel (los intermedios, interpolados)
+class SurfaceTessellator {
+public:
+	// tolerance en pixeles; a lo sumo 2^max_level x 2^max_level celdas por parche
+	SurfaceTessellator(float tolerance=1.f, int max_level=6)
+		: tolerance(tolerance), max_level(max_level) {}
+
+	// Surface: getPatches() (vector de BezierPatch) y getPatchVersion(k);
+	// mvp: matriz de proyeccion*vista*modelo; viewport: tamanio en pixeles.
+	// Devuelve true si la malla cambio (y hay que volver a subirla)
+	template<typename Surface>
+	bool update(const Surface &surface, const glm::mat4 &mvp, glm::vec2 viewport);
+
+	const Geometry &getGeometry() const { return geometry; }
+
+	// cuantas veces se evaluo algun parche (para ver que la cache funciona)
+	int patchesEvaluated() const { return evaluated; }
+
+private:
+	struct Entry {
+		int version = -1;
+		int level = -1, edge_levels[4] = {-1,-1,-1,-1}; // v=0, u=1, v=1, u=0
+		std::vector<glm::vec3> positions, normals; // (n+1)x(n+1), n=2^level
+	};
+	float tolerance;
+	int max_level;
+	int evaluated = 0;
+	std::vector<Entry> cache;
+	Geometry geometry;
+
+	glm::mat4 mvp;
+	glm::vec2 half_viewport;
+
+	bool toScreen(const glm::vec3 &p, glm::vec2 &s) const {
+		glm::vec4 c = mvp*glm::vec4(p,1.f);
+		if (c.w<=1e-6f) return false;
+		s = (glm::vec2(c.x,c.y)/c.w+1.f)*half_viewport;
+		return true;
+	}
+
+	// nivel para que una Bezier de grado d con diferencias segundas de a lo sumo
+	// m pixeles quede a menos de tolerance (m<0: algo cae detras de la camara)
+	int levelFor(float m, int d) const {
+		if (m<0.f) return max_level;
+		float segs = std::sqrt(d*(d-1)/8.f*m/tolerance);
+		int level = 0;
+		while (level<max_level and float(1<<level)<segs) ++level;
+		return level;
+	}
+
+	// mayor diferencia segunda en pantalla de los puntos q[0], q[stride], ...
+	// (-1 si alguno cae detras de la camara, segun ok); (q0+q2)-2*q1 da lo
+	// mismo recorriendo el borde en cualquier sentido
+	static float secondDiff(const glm::vec2 *q, const char *ok, int d, int stride) {
+		float m = 0.f;
+		for(int i=0;i<=d;++i)
+			if (not ok[i*stride]) return -1.f;
+		for(int i=0;i+2<=d;++i)
+			m = std::max(m,glm::length((q[i*stride]+q[(i+2)*stride])-2.f*q[(i+1)*stride]));
+		return m;
+	}
+
+	template<typename Patch>
+	void chooseLevels(const Patch &patch, int &level, int edge_levels[4]) const;
+	template<typename Patch>
+	void evalPatch(const Patch &patch, Entry &e);
+	void rebuildGeometry();
+};
+
+template<typename Surface>
+bool SurfaceTessellator::update(const Surface &surface, const glm::mat4 &new_mvp, glm::vec2 viewport) {
+	mvp = new_mvp; half_viewport = viewport*.5f;
+	const auto &patches = surface.getPatches();
+	int n = patches.size();
+	bool changed = n!=static_cast<int>(cache.size());
+	cache.resize(n);
+	for(int k=0;k<n;++k) {
+		Entry &e = cache[k];
+		int level, edge_levels[4];
+		chooseLevels(patches[k],level,edge_levels);
+		if (e.version==surface.getPatchVersion(k) and e.level==level
+			and std::equal(edge_levels,edge_levels+4,e.edge_levels)) continue;
+		e.version = surface.getPatchVersion(k);
+		e.level = level;
+		std::copy(edge_levels,edge_levels+4,e.edge_levels);
+		evalPatch(patches[k],e);
+		changed = true;
+	}
+	if (changed) rebuildGeometry();
+	return changed;
+}
+
+template<typename Patch>
+void SurfaceTessellator::chooseLevels(const Patch &patch, int &level, int edge_levels[4]) const {
+	const int d = patch.degree(), s = d+1;
+	std::vector<glm::vec2> q(s*s);
+	std::vector<char> ok(s*s);
+	for(int i=0;i<=d;++i)
+		for(int j=0;j<=d;++j)
+			ok[i*s+j] = toScreen(patch[i][j],q[i*s+j]);
+	// bordes: v=0 (columna 0), u=1 (fila d), v=1 (columna d), u=0 (fila 0)
+	edge_levels[0] = levelFor(secondDiff(&q[0],&ok[0],d,s),d);
+	edge_levels[1] = levelFor(secondDiff(&q[d*s],&ok[d*s],d,1),d);
+	edge_levels[2] = levelFor(secondDiff(&q[d],&ok[d],d,s),d);
+	edge_levels[3] = levelFor(secondDiff(&q[0],&ok[0],d,1),d);
+	// interior: la cota del producto tensorial suma la de u y la de v
+	float mu = 0.f, mv = 0.f;
+	for(int k=0;k<=d;++k) {
+		float du = secondDiff(&q[k],&ok[k],d,s), dv = secondDiff(&q[k*s],&ok[k*s],d,1);
+		if (du<0.f or dv<0.f) { mu = -1.f; break; }
+		mu = std::max(mu,du);
+		mv = std::max(mv,dv);
+	}
+	level = levelFor(mu<0.f ? -1.f : mu+mv,d);
+	// la grilla tiene que incluir a los vertices de los bordes
+	level = std::max(level,*std::max_element(edge_levels,edge_levels+4));
+}
+
+template<typename Patch>
+void SurfaceTessellator::evalPatch(const Patch &patch, Entry &e) {
+	++evaluated;
+	const int n = 1<<e.level, s = n+1;
+	std::vector<glm::vec3> du(s*s), dv(s*s);
+	e.positions.resize(s*s);
+	e.normals.resize(s*s);
+	patch.evalGrid(s,s,e.positions.data(),du.data(),dv.data());
+	for(int i=0;i<s*s;++i) e.normals[i] = glm::cross(du[i],dv[i]);
+	// donde se anula (un borde colapsado en un punto) se usa la del vecino hacia adentro
+	for(int a=0;a<s;++a) {
+		for(int b=0;b<s;++b) {
+			glm::vec3 &nr = e.normals[a*s+b];
+			if (glm::dot(nr,nr)>1e-12f) { nr = glm::normalize(nr); continue; }
+			int ia = a==0 ? 1 : (a==n ? n-1 : a), ib = b==0 ? 1 : (b==n ? n-1 : b);
+			glm::vec3 alt = glm::cross(du[ia*s+ib],dv[ia*s+ib]);
+			nr = glm::dot(alt,alt)>1e-12f ? glm::normalize(alt) : glm::vec3(0.f,1.f,0.f);
+		}
+	}
+	// los bordes, desde su curva con su nivel
+	std::vector<glm::vec3> edge;
+	for(int k=0;k<4;++k) {
+		const int ne = 1<<e.edge_levels[k], step = n/ne;
+		auto curve = (k==0 or k==2) ? patch.column(k==0 ? 0 : patch.degree())
+		                            : patch.row(k==3 ? 0 : patch.degree());
+		edge.resize(ne+1);
+		curve.evalUniform(ne+1,edge.data());
+		for(int c=0;c<=n;++c) {
+			int c0 = c/step*step;
+			glm::vec3 p = c0==c ? edge[c0/step] : glm::mix(edge[c0/step],edge[c0/step+1],float(c-c0)/step);
+			int idx = k==0 ? c*s : (k==1 ? n*s+c : (k==2 ? c*s+n : c));
+			e.positions[idx] = p;
+		}
+	}
+}
+
+// junta las grillas de todos los parches en una sola malla
+inline void SurfaceTessellator::rebuildGeometry() {
+	geometry.positions.clear();
+	geometry.normals.clear();
+	geometry.tex_coords.clear();
+	geometry.triangles.clear();
+	for(const Entry &e : cache) {
+		const int n = 1<<e.level, s = n+1, base = geometry.positions.size();
+		geometry.positions.insert(geometry.positions.end(),e.positions.begin(),e.positions.end());
+		geometry.normals.insert(geometry.normals.end(),e.normals.begin(),e.normals.end());
+		for(int a=0;a<s;++a)
+			for(int b=0;b<s;++b)
+				geometry.tex_coords.emplace_back(float(a)/n,float(b)/n);
+		// con cross(du,dv) como normal, los triangulos van en sentido antihorario
+		for(int a=0;a<n;++a) {
+			for(int b=0;b<n;++b) {
+				int i = base+a*s+b;
+				int t[6] = { i, i+s, i+s+1, i, i+s+1, i+1 };
+				geometry.triangles.insert(geometry.triangles.end(),t,t+6);
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "BSplineSurface.hpp"
+#include "Debug.hpp"
+
+int BSplineSurface::last_version = 0;
+
+// cambio de base de B-spline cubica uniforme a Bezier para un tramo con
+// puntos de control g[0..3]: bz[i] = sum M[i][a]*g[a]; el ultimo de un tramo y
+// el primero del siguiente usan los mismos puntos con los mismos coeficientes
+// (y los ceros no alteran la suma), asi que los parches vecinos comparten los
+// bordes exactamente (sin grietas al teselarlos)
+static const float M[4][4] = {
+	{ 1/6.f, 4/6.f, 1/6.f, 0.f },
+	{ 0.f, 4/6.f, 2/6.f, 0.f },
+	{ 0.f, 2/6.f, 4/6.f, 0.f },
+	{ 0.f, 1/6.f, 4/6.f, 1/6.f } };
+
+BSplineSurface::BSplineSurface(int nu, int nv, const std::vector<glm::vec3> &points, bool closed_u, bool closed_v)
+	: nu(nu), nv(nv), closed_u(closed_u), closed_v(closed_v), points(points)
+{
+	cg_assert(nu>=4 and nv>=4,"BSplineSurface needs at least 4x4 control points");
+	cg_assert(static_cast<int>(points.size())==nu*nv,"wrong number of control points");
+	pu = closed_u ? nu : nu-3;
+	pv = closed_v ? nv : nv-3;
+	patches.resize(pu*pv);
+	versions.assign(pu*pv,++last_version);
+	for(int a=0;a<pu;++a) 
+		for(int b=0;b<pv;++b) 
+			updatePatch(a,b);
+}
+
+void BSplineSurface::updatePatch(int a, int b) {
+	// primero en v para cada una de las 4 filas de la ventana, despues en u
+	glm::vec3 h[4][4];
+	for(int r=0;r<4;++r) { 
+		const glm::vec3 *row = &points[((a+r)%nu)*nv];
+		for(int j=0;j<4;++j) { 
+			h[r][j] = glm::vec3(0.f);
+			for(int c=0;c<4;++c) h[r][j] += M[j][c]*row[(b+c)%nv];
+		}
+	}
+	BezierPatch<glm::vec3,3> &patch = patches[a*pv+b];
+	for(int i=0;i<4;++i) { 
+		for(int j=0;j<4;++j) { 
+			patch[i][j] = glm::vec3(0.f);
+			for(int r=0;r<4;++r) patch[i][j] += M[i][r]*h[r][j];
+		}
+	}
+}
+
+// el punto (i,j) influye en los parches cuya ventana lo contiene: a lo sumo 4x4
+void BSplineSurface::setControlPoint(int i, int j, glm::vec3 p) {
+	cg_assert(i>=0 and i<nu and j>=0 and j<nv,"control point out of range");
+	points[i*nv+j] = p;
+	++last_version;
+	for(int da=0;da<4;++da) { 
+		int a = i-da;
+		if (closed_u) a = (a+nu)%nu; else if (a<0 or a>=pu) continue;
+		for(int db=0;db<4;++db) { 
+			int b = j-db;
+			if (closed_v) b = (b+nv)%nv; else if (b<0 or b>=pv) continue;
+			updatePatch(a,b);
+			versions[a*pv+b] = last_version;
+		}
+	}
+}
+
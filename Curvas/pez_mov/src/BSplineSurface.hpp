@@ -0,0 +1,38 @@
+#ifndef BSPLINESURFACE_HPP
+#define BSPLINESURFACE_HPP
+
+#include <vector>
+#include <glm/glm.hpp>
+#include "BezierPatch.hpp"
+
+// Superficie B-spline cubica uniforme (producto tensorial) definida por una
+// red de nu x nv puntos de control, guardada como parches de Bezier bicubicos
+// (uno por cada ventana de 4x4 puntos de la red), que es lo que evaluan y
+// dibujan BezierPatch y SurfaceTessellator. Con closed_u/closed_v la red se
+// cierra en esa direccion (un tubo, o un toro si se cierra en las dos)
+class BSplineSurface {
+public:
+	// points[i*nv+j] es el punto (i,j) de la red
+	BSplineSurface(int nu, int nv, const std::vector<glm::vec3> &points, bool closed_u=false, bool closed_v=false);
+	void setControlPoint(int i, int j, glm::vec3 p);
+	glm::vec3 getControlPoint(int i, int j) const { return points[i*nv+j]; }
+	int getControlPointsCountU() const { return nu; }
+	int getControlPointsCountV() const { return nv; }
+	// los parches por filas: el (a,b) en getPatches()[a*getPatchesCountV()+b]
+	const std::vector<BezierPatch<glm::vec3,3>> &getPatches() const { return patches; }
+	int getPatchesCountU() const { return pu; }
+	int getPatchesCountV() const { return pv; }
+	// como getPieceVersion de Spline: cambia cada vez que se modifica el parche k
+	int getPatchVersion(int k) const { return versions[k]; }
+private:
+	int nu, nv, pu, pv;
+	bool closed_u, closed_v;
+	std::vector<glm::vec3> points;
+	std::vector<BezierPatch<glm::vec3,3>> patches;
+	std::vector<int> versions;
+	static int last_version;
+	void updatePatch(int a, int b);
+};
+
+#endif
+
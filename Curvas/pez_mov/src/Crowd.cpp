@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "Crowd.hpp"
+#include "Debug.hpp"
+
+CrowdAgents::CrowdAgents(int count, int paths_count, unsigned seed)
+	: paths_count(paths_count), seed(seed)
+{
+	cg_assert(paths_count>0,"Crowd needs at least one path");
+	resize(count);
+}
+
+void CrowdAgents::resize(int count) {
+	int from = size();
+	path.resize(count);
+	position.resize(count);
+	speed.resize(count);
+	lateral.resize(count);
+	scale.resize(count);
+	phase.resize(count);
+	transforms.resize(count,glm::mat4(1.f));
+	if (count>from) initAgents(from);
+}
+
+void CrowdAgents::initAgents(int from) {
+	// cada tanda con su propia semilla, asi agregar peces no cambia los que ya estaban
+	std::mt19937 rng(seed+static_cast<unsigned>(from));
+	std::uniform_real_distribution<float> u01(0.f,1.f);
+	std::normal_distribution<float> gauss(0.f,1.f);
+	for(int i=from;i<size();++i) {
+		path[i] = std::min(static_cast<int>(u01(rng)*paths_count),paths_count-1);
+		position[i] = u01(rng);
+		speed[i] = 0.7f+0.6f*u01(rng);
+		lateral[i] = glm::vec2(gauss(rng),gauss(rng))*0.12f;
+		scale[i] = 0.05f+0.04f*u01(rng);
+		phase[i] = u01(rng);
+	}
+}
+
+void CrowdAgents::update(float step, const std::vector<const Spline*> &paths) {
+	cg_assert(static_cast<int>(paths.size())==paths_count,"Wrong number of paths");
+	std::vector<double> lengths(paths_count);
+	for(int k=0;k<paths_count;++k) lengths[k] = paths[k]->getLength();
+	int n = size();
+	#pragma omp parallel for
+	for(int i=0;i<n;++i) {
+		float p = position[i]+step*speed[i];
+		position[i] = p-std::floor(p);
+		const Spline &spline = *paths[path[i]];
+		glm::mat4 m = spline.frameAt(spline.tAtDistance(position[i]*lengths[path[i]]));
+		m[3] += m[1]*lateral[i].x + m[2]*lateral[i].y;
+		m[0] *= scale[i]; m[1] *= scale[i]; m[2] *= scale[i];
+		transforms[i] = m;
+	}
+}
+
+Crowd::Crowd(int count, int paths_count, unsigned seed)
+	: agents(count,paths_count,seed), shader("shaders/fish_crowd.vert","shaders/fish.frag")
+{
+	glGenBuffers(2,VBO);
+}
+
+Crowd::~Crowd() {
+	glDeleteBuffers(2,VBO);
+}
+
+Shader &Crowd::getShader() {
+	shader.use();
+	return shader;
+}
+
+void Crowd::setInstanceAttributes(bool enable) {
+	GLint loc_mat = glGetAttribLocation(shader.getProgramId(), "instanceMatrix");
+	GLint loc_phase = glGetAttribLocation(shader.getProgramId(), "instancePhase");
+	cg_assert(loc_mat!=-1 and loc_phase!=-1,"Shader does not have instance attributes");
+	if (not enable) {
+		// el VAO es el del modelo, que tambien se dibuja con otros shaders
+		for(int c=0;c<4;++c) {
+			glVertexAttribDivisor(loc_mat+c,0);
+			glDisableVertexAttribArray(loc_mat+c);
+		}
+		glVertexAttribDivisor(loc_phase,0);
+		glDisableVertexAttribArray(loc_phase);
+		return;
+	}
+	// un mat4 ocupa 4 atributos consecutivos, uno por columna
+	glBindBuffer(GL_ARRAY_BUFFER,VBO[0]);
+	for(int c=0;c<4;++c) {
+		glVertexAttribPointer(loc_mat+c, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), reinterpret_cast<void*>(c*sizeof(glm::vec4)));
+		glVertexAttribDivisor(loc_mat+c,1);
+		glEnableVertexAttribArray(loc_mat+c);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER,VBO[1]);
+	glVertexAttribPointer(loc_phase, 1, GL_FLOAT, GL_FALSE, 0, 0);
+	glVertexAttribDivisor(loc_phase,1);
+	glEnableVertexAttribArray(loc_phase);
+}
+
+void Crowd::draw(const std::vector<Model> &models) {
+	if (size()==0) return;
+
+	// las matrices cambian en cada cuadro (se descarta el buffer anterior para
+	// no esperar a que termine de usarlo el cuadro previo); las fases solo
+	// cuando cambia la cantidad
+	glBindBuffer(GL_ARRAY_BUFFER,VBO[0]);
+	const std::vector<glm::mat4> &transforms = agents.getTransforms();
+	glBufferData(GL_ARRAY_BUFFER, transforms.size()*sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, transforms.size()*sizeof(glm::mat4), transforms.data());
+	if (phases_changed) {
+		glBindBuffer(GL_ARRAY_BUFFER,VBO[1]);
+		const std::vector<float> &phase = agents.getPhases();
+		glBufferData(GL_ARRAY_BUFFER, phase.size()*sizeof(float), phase.data(), GL_STATIC_DRAW);
+		phases_changed = false;
+	}
+
+	for(const Model &model : models) {
+		shader.setBuffers(model.buffers); // deja activo el VAO del modelo
+		setInstanceAttributes(true);
+		shader.setMaterial(model.material);
+		model.buffers.drawInstanced(size());
+		glBindVertexArray(model.buffers.vertexArray());
+		setInstanceAttributes(false);
+		glBindVertexArray(0);
+	}
+}
+
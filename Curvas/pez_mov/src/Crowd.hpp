@@ -0,0 +1,78 @@
+#ifndef CROWD_HPP
+#define CROWD_HPP
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "Shaders.hpp"
+#include "Model.hpp"
+#include "Spline.hpp"
+
+// Los peces de un cardumen, sin nada de OpenGL: cada uno sigue una de varias
+// splines con su propia posicion inicial, velocidad, separacion de la curva y
+// tamanio. Los datos se guardan por campo (un vector para cada cosa) y update
+// calcula todas las matrices en paralelo (OpenMP) con tAtDistance y frameAt
+// de la spline de cada uno
+class CrowdAgents {
+public:
+	// count peces repartidos al azar entre paths_count caminos
+	CrowdAgents(int count, int paths_count=1, unsigned seed=0);
+
+	// cambia la cantidad de peces (los que ya estaban no cambian)
+	void resize(int count);
+	int size() const { return path.size(); }
+
+	// avanza cada pez step*speed (en fraccion de la longitud de su camino) y
+	// recalcula las matrices; paths[getPath(i)] es el camino del pez i
+	void update(float step, const std::vector<const Spline*> &paths);
+
+	int getPath(int i) const { return path[i]; }
+	float getPosition(int i) const { return position[i]; } // fraccion recorrida, en [0,1)
+	const std::vector<glm::mat4> &getTransforms() const { return transforms; }
+	const std::vector<float> &getPhases() const { return phase; }
+
+private:
+	int paths_count;
+	unsigned seed;
+
+	// datos de cada pez
+	std::vector<int> path;             // indice de su camino
+	std::vector<float> position;       // fraccion recorrida de su camino, en [0,1)
+	std::vector<float> speed;          // relativa a la del paso de update
+	std::vector<glm::vec2> lateral;    // separacion de la curva, en (normal,binormal)
+	std::vector<float> scale;
+	std::vector<float> phase;          // desfasaje del aleteo
+	std::vector<glm::mat4> transforms; // resultado de update
+
+	// agrega los peces desde el from-esimo hasta completar size() (ya redimensionados)
+	void initAgents(int from);
+};
+
+// Dibuja un cardumen (CrowdAgents): draw sube las matrices en un solo VBO y
+// dibuja cada parte del modelo con un draw instanciado (shaders/fish_crowd.vert
+// lee la matriz y la fase del aleteo de cada instancia)
+class Crowd {
+public:
+	Crowd(int count, int paths_count=1, unsigned seed=0);
+	~Crowd();
+	Crowd(const Crowd&) = delete;
+	Crowd &operator=(const Crowd&) = delete;
+
+	void resize(int count) { agents.resize(count); phases_changed = true; }
+	int size() const { return agents.size(); }
+	void update(float step, const std::vector<const Spline*> &paths) { agents.update(step,paths); }
+
+	Shader &getShader();
+	void draw(const std::vector<Model> &models);
+
+private:
+	CrowdAgents agents;
+	Shader shader;
+	GLuint VBO[2] = {0,0}; // matrices y fases
+	bool phases_changed = true;
+
+	// habilita (o deshabilita) los atributos por instancia en el VAO que este activo
+	void setInstanceAttributes(bool enable);
+};
+
+#endif
+
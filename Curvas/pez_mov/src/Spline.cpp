@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <cmath>
 #include "Spline.hpp"
 #include "Debug.hpp"
 
 const static int degree = 3;
 
+int Spline::last_version = 0;
+
 Spline::Spline (const std::vector<glm::vec3> & vp, bool close) : m_closed(close) {
 	auto it = vp.begin();
 	glm::vec3 p = *it, q = *it;;
@@ -12,15 +16,28 @@ Spline::Spline (const std::vector<glm::vec3> & vp, bool close) : m_closed(close)
 		p = q;
 	}
 	if (close) pieces.push_back(Bezier<>({p,(p+p+q)/3.f,(p+q+q)/3.f,q}));
+	versions.assign(pieces.size(),++last_version);
+	arc_table.resize(pieces.size());
+	for(size_t i=0;i<pieces.size();++i) updateArcTable(i);
+	updateCumulative();
+	updateFrames(0);
 }
 
 void Spline::setControlPoint (int i, glm::vec3 p) {
 	auto idxs = getIndexes(i);
 	pieces[idxs.first][idxs.second] = p;
+	versions[idxs.first] = ++last_version;
+	int first_changed = idxs.first;
 	if (idxs.second==0 and (m_closed or idxs.first!=0)) {
 		int psz = pieces.size();
 		pieces[(idxs.first+psz-1)%psz][degree] = p;
+		versions[(idxs.first+psz-1)%psz] = last_version;
+		updateArcTable((idxs.first+psz-1)%psz);
+		first_changed = std::min(first_changed,(idxs.first+psz-1)%psz);
 	}
+	updateArcTable(idxs.first);
+	updateCumulative();
+	updateFrames(first_changed);
 }
 
 glm::vec3 Spline::getControlPoint (int i) const {
@@ -42,6 +59,9 @@ std::pair<int,double> Spline::mapT (double t) const {
 	double taux = t*pieces.size();
 	int ipiece = static_cast<int>(taux);
 	double tpiece = taux - static_cast<double>(ipiece);
+	// en una abierta t=1 es el final de la ultima, no el inicio de la primera
+	if (not m_closed and ipiece>=static_cast<int>(pieces.size())) 
+		return {static_cast<int>(pieces.size())-1,1.0};
 	return {ipiece,tpiece};
 }
 
@@ -68,3 +88,152 @@ int Spline::getControlPointsCount() const {
 const std::vector<Bezier<>> &Spline::getPieces() const { 
 	return pieces; 
 }
+
+// Gauss-Legendre de 5 puntos de |B'(u)| en [u0,u1]; |B'| de una cubica es
+// la raiz de un polinomio de grado 4, y en un tramo de la tabla queda muy bien
+// aproximada (salvo cerca de una cuspide, donde B' se anula)
+double Spline::arcLength(int ipiece, double u0, double u1) const {
+	static const double x[5] = { -0.9061798459386640, -0.5384693101056831, 0.0, 
+	                             0.5384693101056831, 0.9061798459386640 };
+	static const double w[5] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 
+	                             0.4786286704993665, 0.2369268850561891 };
+	double c = (u0+u1)/2, h = (u1-u0)/2, l = 0.0;
+	for(int i=0;i<5;++i) { 
+		glm::vec3 d;
+		pieces[ipiece].at(c+h*x[i],d);
+		l += w[i]*glm::length(d);
+	}
+	return l*h;
+}
+
+void Spline::updateArcTable(int ipiece) {
+	auto &tab = arc_table[ipiece];
+	tab[0] = 0.0;
+	for(int k=0;k<arc_steps;++k) 
+		tab[k+1] = tab[k] + arcLength(ipiece,double(k)/arc_steps,double(k+1)/arc_steps);
+}
+
+void Spline::updateCumulative() {
+	cumulative.resize(pieces.size()+1);
+	cumulative[0] = 0.0;
+	for(size_t i=0;i<pieces.size();++i) 
+		cumulative[i+1] = cumulative[i] + arc_table[i][arc_steps];
+}
+
+// Busqueda binaria de la pieza (en las acumuladas) y del tramo dentro de la
+// pieza, interpolacion lineal en el tramo como primera aproximacion, y Newton
+// sobre L(u)-s (L' = |B'|) para corregirla
+double Spline::tAtDistance(double s) const {
+	double total = getLength();
+	int n = pieces.size();
+	if (total<=0.0) return 0.0;
+	if (m_closed) {
+		s = std::fmod(s,total);
+		if (s<0) s += total;
+	} else 
+		s = std::min(std::max(s,0.0),total);
+	int i = std::upper_bound(cumulative.begin()+1,cumulative.end(),s)-cumulative.begin()-1;
+	i = std::min(i,n-1);
+	double r = s-cumulative[i];
+	const auto &tab = arc_table[i];
+	int k = std::upper_bound(tab.begin()+1,tab.end(),r)-tab.begin()-1;
+	k = std::min(k,arc_steps-1);
+	double largo = tab[k+1]-tab[k], u0 = double(k)/arc_steps, u1 = double(k+1)/arc_steps;
+	double u = u0 + (largo>0 ? (r-tab[k])/largo : 0.0)/arc_steps;
+	for(int it=0;it<2;++it) { 
+		glm::vec3 d;
+		pieces[i].at(u,d);
+		double v = glm::length(d);
+		if (v<1e-9) break;
+		double f = tab[k]+arcLength(i,u0,u)-r;
+		u = std::min(std::max(u-f/v,u0),u1);
+	}
+	return (i+u)/n;
+}
+
+glm::vec3 Spline::atDistance(double s) const {
+	return at(tAtDistance(s));
+}
+
+glm::vec3 Spline::atDistance(double s, glm::vec3 &deriv) const {
+	return at(tAtDistance(s),deriv);
+}
+
+// Doble reflexion (Wang et al.): reflejar la normal en el plano bisector de
+// la cuerda entre dos muestras lleva la tangente a una que no es la nueva, y
+// una segunda reflexion en el plano bisector entre esas dos tangentes la
+// corrige; el resultado aproxima la rotacion minima con error O(h^4); si las
+// dos muestras estan en el mismo lugar (la union entre dos piezas) la primera
+// reflexion es en el plano de la tangente vieja y el eje de giro, y queda el
+// giro minimo entre las dos tangentes
+static glm::vec3 transportNormal(glm::vec3 r, glm::vec3 x0, glm::vec3 t0, glm::vec3 x1, glm::vec3 t1) {
+	glm::vec3 v1 = x1-x0, tl = t0;
+	float c1 = glm::dot(v1,v1);
+	if (c1>0.f) tl = t0-v1*(2.f/c1*glm::dot(v1,t0));
+	else { v1 = t1-t0*glm::dot(t0,t1); c1 = glm::dot(v1,v1); }
+	if (c1>0.f) r = r-v1*(2.f/c1*glm::dot(v1,r));
+	glm::vec3 v2 = t1-tl;
+	float c2 = glm::dot(v2,v2);
+	if (c2>0.f) r = r-v2*(2.f/c2*glm::dot(v2,r));
+	return glm::normalize(r-t1*glm::dot(r,t1));
+}
+
+void Spline::updateFrames(int from_piece) {
+	int n = pieces.size();
+	frame_normals.resize(n*(frame_steps+1));
+	auto sample = [&](int i, int k, glm::vec3 &x, glm::vec3 &tg) {
+		glm::vec3 d;
+		x = pieces[i].at(float(k)/frame_steps,d);
+		tg = glm::length(d)>0.f ? glm::normalize(d) : glm::vec3(1.f,0.f,0.f);
+	};
+	glm::vec3 x0, t0, x1, t1;
+	for(int i=from_piece;i<n;++i) {
+		glm::vec3 *r = &frame_normals[i*(frame_steps+1)];
+		sample(i,0,x1,t1);
+		if (i==0) { // la primera: lo mas parecida posible a "arriba"
+			glm::vec3 up = std::fabs(t1.y)<.99f ? glm::vec3(0.f,1.f,0.f) : glm::vec3(1.f,0.f,0.f);
+			r[0] = glm::normalize(up-t1*glm::dot(up,t1));
+		} else {
+			sample(i-1,frame_steps,x0,t0);
+			r[0] = transportNormal(r[-1],x1,t0,x1,t1);
+		}
+		for(int k=1;k<=frame_steps;++k) {
+			x0 = x1; t0 = t1;
+			sample(i,k,x1,t1);
+			r[k] = transportNormal(r[k-1],x0,t0,x1,t1);
+		}
+	}
+	// en una cerrada, cuanto giro la normal alrededor de la tangente al volver al inicio
+	frame_twist = 0.f;
+	if (m_closed) {
+		sample(n-1,frame_steps,x0,t0);
+		sample(0,0,x1,t1);
+		glm::vec3 a = transportNormal(frame_normals.back(),x1,t0,x1,t1), b = frame_normals[0];
+		frame_twist = std::atan2(glm::dot(glm::cross(a,b),t1),glm::dot(a,b));
+	}
+}
+
+glm::mat4 Spline::frameAt(double t) const {
+	if (m_closed) t -= std::floor(t);
+	else t = std::min(std::max(t,0.0),1.0);
+	auto p = mapT(t);
+	int i = p.first%pieces.size();
+	double x = p.second*frame_steps;
+	int k = std::min(static_cast<int>(x),frame_steps-1);
+	float f = float(x-k);
+	glm::vec3 deriv, pos = pieces[i].at(p.second,deriv);
+	glm::vec3 tg = glm::length(deriv)>0.f ? glm::normalize(deriv) : glm::vec3(1.f,0.f,0.f);
+	// interpolar la normal de la tabla, quitarle lo que tenga de tangente y
+	// girarla lo que le toque de frame_twist para que cierre
+	const glm::vec3 *r = &frame_normals[i*(frame_steps+1)+k];
+	glm::vec3 n = r[0]*(1.f-f)+r[1]*f;
+	n = glm::normalize(n-tg*glm::dot(n,tg));
+	float a = frame_twist*float(t);
+	n = n*std::cos(a)+glm::cross(tg,n)*std::sin(a);
+	glm::mat4 mat(1.f);
+	mat[0] = glm::vec4(tg,0.f);
+	mat[1] = glm::vec4(n,0.f);
+	mat[2] = glm::vec4(glm::cross(tg,n),0.f);
+	mat[3] = glm::vec4(pos,1.f);
+	return mat;
+}
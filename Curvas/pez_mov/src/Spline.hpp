@@ -1,6 +1,7 @@
 #ifndef SPLINE_HPP
 #define SPLINE_HPP
 
+#include <array>
 #include <initializer_list>
 #include <vector>
 #include <glm/glm.hpp>
@@ -16,9 +17,50 @@ public:
 	int getControlPointsCount() const;
 	const std::vector<Bezier<>> &getPieces() const;
 	bool IsClosed() const { return m_closed; }
+	// cambia cada vez que se modifica la pieza i (y no se repite entre splines
+	// distintas), para que quien dibuja sepa que piezas tiene que actualizar
+	int getPieceVersion(int i) const { return versions[i]; }
+	
+	// longitud de arco: la total, y el parametro t (el de at) o el punto que
+	// estan a distancia s del inicio medida sobre la curva (en una cerrada s da
+	// la vuelta, en una abierta se recorta a [0,getLength()]); sirve para
+	// recorrerla a velocidad constante con s = velocidad*tiempo
+	double getLength() const { return cumulative.back(); }
+	double tAtDistance(double s) const;
+	glm::vec3 atDistance(double s) const;
+	glm::vec3 atDistance(double s, glm::vec3 &deriv) const;
+	
+	// sistema de referencia que minimiza la rotacion a lo largo de la curva
+	// (sin giros alrededor de la tangente mas alla de los que impone la forma,
+	// y sin darse vuelta si la tangente queda vertical): columnas x = tangente,
+	// y = normal, z = binormal y en la ultima la posicion, para usar como matriz
+	// de modelo; sale de una tabla precalculada, asi que cuesta O(1)
+	glm::mat4 frameAt(double t) const;
 private:
 	bool m_closed;
 	std::vector<Bezier<glm::vec3,3>> pieces;
+	std::vector<int> versions;
+	static int last_version;
+	
+	// tabla de longitudes: de cada pieza, la longitud desde su inicio hasta
+	// cada uno de arc_steps tramos iguales de su parametro (se rehace solo la
+	// de las piezas que cambian); y la acumulada hasta el inicio de cada pieza
+	static constexpr int arc_steps = 16;
+	std::vector<std::array<double,arc_steps+1>> arc_table;
+	std::vector<double> cumulative;
+	void updateArcTable(int ipiece);
+	void updateCumulative();
+	double arcLength(int ipiece, double u0, double u1) const;
+	
+	// normales (rotation minimizing frame, por doble reflexion) en frame_steps+1
+	// muestras por pieza (los extremos de cada una, porque en las uniones puede
+	// cambiar la tangente); como cada una sale de la anterior, al cambiar una
+	// pieza se recalculan desde ahi; en una cerrada la ultima no coincide con la
+	// primera, y el angulo entre ellas se reparte a lo largo de la curva al consultar
+	static constexpr int frame_steps = 16;
+	std::vector<glm::vec3> frame_normals;
+	float frame_twist = 0.f;
+	void updateFrames(int from_piece);
 	std::pair<int,double> mapT(double t) const;
 	std::pair<int,int> getIndexes(int i) const;
 };
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include "SplineRenderer.hpp"
+#include "Callbacks.hpp"
+#include "CurveFlattening.hpp"
+#include "Debug.hpp"
+
+SplineRenderer::SplineRenderer(float tolerance) : shader("shaders/curve"), tolerance(tolerance) { 
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+	glGenBuffers(1, &VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	GLint loc_pos = glGetAttribLocation(shader.getProgramId(), "vertexPosition"); 
+	cg_assert(loc_pos!=-1,"Shader does not have vertexPosition attribute");
+	glVertexAttribPointer(loc_pos, 3, GL_FLOAT, GL_FALSE, 0, 0);
+	glEnableVertexAttribArray(loc_pos);
+	glBindVertexArray(0);
+}
+
+SplineRenderer::~SplineRenderer() {
+	glDeleteBuffers(1,&VBO);
+	glDeleteVertexArrays(1,&VAO);
+}
+
+Shader &SplineRenderer::getShader() {
+	shader.use();
+	return shader;
+}
+
+void SplineRenderer::update(const Spline &spline) {
+	auto ms = common_callbacks::getMatrixes();
+	glm::mat4 new_mvp = ms[2]*ms[1]*ms[0];
+	glm::vec2 new_viewport(win_width,win_height);
+	const auto &pieces = spline.getPieces();
+	int n = pieces.size();
+	if (n!=static_cast<int>(versions.size()) or new_mvp!=mvp or new_viewport!=viewport) {
+		mvp = new_mvp; viewport = new_viewport;
+		rebuild(spline);
+		return;
+	}
+	
+	CurveFlattening flattening(mvp,viewport,tolerance);
+	std::vector<int> changed;
+	for(int i=0;i<n;++i) { 
+		if (versions[i]==spline.getPieceVersion(i)) continue;
+		versions[i] = spline.getPieceVersion(i);
+		curves[i].clear();
+		flattening.flatten(pieces[i],curves[i]);
+		if (static_cast<int>(curves[i].size())>slot) { rebuild(spline); return; }
+		changed.push_back(i);
+	}
+	
+	// cada pieza cambia sus 4 puntos de control y su espacio de la curva
+	glBindBuffer(GL_ARRAY_BUFFER,VBO);
+	for(int i : changed) { 
+		glBufferSubData(GL_ARRAY_BUFFER, 3*i*sizeof(glm::vec3), 4*sizeof(glm::vec3), pieces[i].data());
+		glBufferSubData(GL_ARRAY_BUFFER, firsts[i]*sizeof(glm::vec3), curves[i].size()*sizeof(glm::vec3), curves[i].data());
+		counts[i] = curves[i].size();
+	}
+}
+
+// tesela todas las piezas y sube todo junto, con espacio de sobra por pieza
+// para que al mover puntos de control casi nunca haya que volver a hacerlo
+void SplineRenderer::rebuild(const Spline &spline) {
+	const auto &pieces = spline.getPieces();
+	int n = pieces.size();
+	versions.resize(n); curves.resize(n); firsts.resize(n); counts.resize(n);
+	CurveFlattening flattening(mvp,viewport,tolerance);
+	size_t max_count = 0;
+	for(int i=0;i<n;++i) { 
+		versions[i] = spline.getPieceVersion(i);
+		curves[i].clear();
+		flattening.flatten(pieces[i],curves[i]);
+		max_count = std::max(max_count,curves[i].size());
+	}
+	slot = std::max<int>(16,max_count*2);
+	
+	std::vector<glm::vec3> data(controlPointsCount()+n*slot);
+	for(int i=0;i<n;++i) { 
+		std::copy(pieces[i].data(),pieces[i].data()+4,data.begin()+3*i);
+		firsts[i] = controlPointsCount()+i*slot;
+		counts[i] = curves[i].size();
+		std::copy(curves[i].begin(),curves[i].end(),data.begin()+firsts[i]);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER,VBO);
+	glBufferData(GL_ARRAY_BUFFER, data.size()*sizeof(glm::vec3), data.data(), GL_DYNAMIC_DRAW);
+}
+
+void SplineRenderer::drawCurve() {
+	if (versions.empty()) return;
+	glBindVertexArray(VAO);
+	shader.setUniform("color",color_curve);
+	glMultiDrawArrays(GL_LINE_STRIP, firsts.data(), counts.data(), firsts.size());
+	glBindVertexArray(0);
+}
+
+void SplineRenderer::drawPoly() {
+	if (versions.empty()) return;
+	glBindVertexArray(VAO);
+	shader.setUniform("color",color_poly);
+	glDrawArrays(GL_LINE_STRIP, 0, controlPointsCount());
+	glBindVertexArray(0);
+}
+
+void SplineRenderer::drawPoints() {
+	if (versions.empty()) return;
+	glBindVertexArray(VAO);
+	shader.setUniform("color",color_points);
+	glDrawArrays(GL_POINTS, 0, controlPointsCount());
+	glBindVertexArray(0);
+}
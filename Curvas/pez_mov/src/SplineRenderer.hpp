@@ -0,0 +1,47 @@
+#ifndef SPLINERENDERER_HPP
+#define SPLINERENDERER_HPP
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "Shaders.hpp"
+#include "Spline.hpp"
+
+// Dibuja una spline completa desde un solo VBO que se conserva entre cuadros:
+// al principio los 3N+1 puntos de control (en orden, asi el poligono de control
+// es un line strip) y despues un espacio fijo por pieza para su polilinea
+// (CurveFlattening, que depende de la vista). En cada update solo se vuelven a
+// teselar y subir las piezas cuya version cambio (setControlPoint), salvo que
+// cambie la vista, la cantidad de piezas o alguna ya no entre en su espacio,
+// que se arma y se sube todo de nuevo. Curva, poligono y puntos son tres draws
+class SplineRenderer {
+public:
+	// tolerance: cuanto puede alejarse (en pixeles) la polilinea de la curva
+	SplineRenderer(float tolerance=0.5f);
+	~SplineRenderer();
+	SplineRenderer(const SplineRenderer&) = delete;
+	SplineRenderer &operator=(const SplineRenderer&) = delete;
+	Shader &getShader();
+	void update(const Spline &spline);
+	void drawCurve();
+	void drawPoly();
+	void drawPoints();
+private:
+	Shader shader;
+	GLuint VAO=0, VBO=0;
+	float tolerance;
+	glm::mat4 mvp = glm::mat4(0.f); // vista con la que se teselo
+	glm::vec2 viewport = {0.f,0.f};
+	int slot = 0; // vertices reservados por pieza para la curva
+	std::vector<int> versions; // de cada pieza al teselarla
+	std::vector<std::vector<glm::vec3>> curves; // polilinea de cada pieza
+	std::vector<GLint> firsts;
+	std::vector<GLsizei> counts;
+	glm::vec3 color_curve = {1.f, 1.f, 1.f};
+	glm::vec3 color_poly = {.0f, .0f, .0f};
+	glm::vec3 color_points = {0.f, 0.f, 0.f};
+	
+	int controlPointsCount() const { return 3*versions.size()+1; }
+	void rebuild(const Spline &spline);
+};
+
+#endif
@@ -0,0 +1,72 @@
+// Benchmark de la evaluacion de curvas de Bezier de grado 1 a 7: compara
+// evaluar 1M de parametros de a uno con at (de Casteljau recursivo, Decast)
+// contra evalMany (Horner por bloques) con los mismos parametros al azar, y
+// contra evalUniform (diferencias hacia adelante) con parametros equiespaciados,
+// informando tambien el maximo error respecto de at. Corre antes del main, pero
+// solo si se compila con BENCH_BEZIER definida (por ej. -DBENCH_BEZIER en el
+// proyecto); al terminar sale sin abrir la ventana.
+#ifdef BENCH_BEZIER
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Bezier.hpp"
+
+struct BenchBezier {
+	using reloj = std::chrono::steady_clock;
+	static double segundos(reloj::time_point t0) {
+		return std::chrono::duration<double>(reloj::now()-t0).count();
+	}
+	static float error(const std::vector<glm::vec3> &a, const std::vector<glm::vec3> &b) {
+		float e = 0.f;
+		for(size_t i=0;i<a.size();++i) 
+			e = std::max(e,glm::length(a[i]-b[i]));
+		return e;
+	}
+	
+	template<int D>
+	static void medir(int n, std::minstd_rand &rng) {
+		std::uniform_real_distribution<float> dist(-1.f,1.f);
+		Bezier<glm::vec3,D> b;
+		for(int j=0;j<=D;++j) b[j] = {dist(rng),dist(rng),dist(rng)};
+		std::vector<float> ts(n);
+		for(float &t : ts) t = (dist(rng)+1.f)/2.f;
+		std::vector<glm::vec3> ref(n), out(n);
+		
+		auto t0 = reloj::now();
+		for(int i=0;i<n;++i) ref[i] = b.at(ts[i]);
+		double t_at = segundos(t0);
+		
+		t0 = reloj::now();
+		b.evalMany(ts.data(),n,out.data());
+		double t_many = segundos(t0);
+		float e_many = error(ref,out);
+		
+		for(int i=0;i<n;++i) ts[i] = float(i)/(n-1);
+		for(int i=0;i<n;++i) ref[i] = b.at(ts[i]);
+		t0 = reloj::now();
+		b.evalUniform(n,out.data());
+		double t_unif = segundos(t0);
+		float e_unif = error(ref,out);
+		
+		std::cout << "grado " << D << ": at " << t_at << "s  evalMany " << t_many 
+			      << "s (error " << e_many << ")  evalUniform " << t_unif 
+				  << "s (error " << e_unif << ")" << std::endl;
+	}
+	
+	BenchBezier() {
+		std::minstd_rand rng(42);
+		int n = 1000000;
+		medir<1>(n,rng); medir<2>(n,rng); medir<3>(n,rng); medir<4>(n,rng);
+		medir<5>(n,rng); medir<6>(n,rng); medir<7>(n,rng);
+		std::exit(0);
+	}
+};
+
+BenchBezier bench_bezier;
+
+#endif
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 #include <vector>
 #include <limits>
@@ -11,13 +12,19 @@
 #include "Callbacks.hpp"
 #include "Debug.hpp"
 #include "Shaders.hpp"
-#include "BezierRenderer.hpp"
 #include "Spline.hpp"
+#include "SplineRenderer.hpp"
+#include "Crowd.hpp"
+#include "BSplineSurface.hpp"
+#include "SurfaceTessellator.hpp"
 
 #define VERSION 20241022
 
 // settings
-bool show_axis = false, show_fish = false, show_spline = true, show_poly = true, animate = true;
+bool show_axis = false, show_fish = false, show_spline = true, show_poly = true, animate = true,
+     constant_speed = true, // t recorre la spline por longitud de arco y no por piezas
+     show_crowd = false, show_seabed = false;
+int crowd_size = 2000; // cantidad de peces del cardumen
 
 // curva
 static const int degree = 3;
@@ -54,23 +61,24 @@ void keyboardCallback(GLFWwindow* glfw_win, int key, int scancode, int action, i
 void characterCallback(GLFWwindow* glfw_win, unsigned int code);
 
 glm::mat4 getTransform(const Spline &spline, double t) {
-	/// @todo: obtener los ejes y la nueva posicion del origen en funcion
-	///        de la curva y el valor del parametro t
-	
-	glm::vec3 deriv;
-	glm::vec3 pos = spline.at(t,deriv);
+	// ejes de un sistema que minimiza la rotacion a lo largo de la curva: con un
+	// "arriba" fijo el pez se daba vuelta (o se aplastaba) cuando la tangente
+	// quedaba cerca de la vertical
+	return spline.frameAt(t);
+}
 
-	glm::vec3 e_x = glm::normalize(deriv);
-	glm::vec3 e_y(0.f,1.f,0.f);
-	glm::vec3 e_z = glm::cross(e_x,e_y);
-	
-	// armar la matriz
-	glm::mat4 m(1.f);
-	m[0] = glm::vec4(e_x,0.f);
-	m[1] = glm::vec4(e_y,0.f);
-	m[2] = glm::vec4(e_z,0.f);
-	m[3] = glm::vec4(pos,1.f);
-	return m;
+// fondo del mar: una superficie B-spline con ondulaciones debajo de la curva
+BSplineSurface makeSeabed() {
+	const int n = 10;
+	std::vector<glm::vec3> vp;
+	for(int i=0;i<n;++i) { 
+		for(int j=0;j<n;++j) { 
+			// i recorre z y j recorre x, asi cross(du,dv) (la normal) apunta hacia arriba
+			float x = -2.f+4.f*j/(n-1), z = -2.f+4.f*i/(n-1);
+			vp.push_back({x, -.6f+.15f*std::sin(3.f*x)*std::cos(2.f*z)+.05f*std::sin(7.f*z), z});
+		}
+	}
+	return BSplineSurface(n,n,vp);
 }
 
 // cuando cambia la cant de tramos, regenerar la spline
@@ -104,7 +112,14 @@ int main() {
 	Shader shader_phong("shaders/phong");
 	auto fish = Model::load("models/fish");
 	auto axis = Model::load("models/axis",Model::fDontFit);
-	BezierRenderer bezier_renderer(500);
+	SplineRenderer spline_renderer(0.5f); // tolerancia en pixeles
+	Crowd crowd(crowd_size);
+	BSplineSurface seabed = makeSeabed();
+	SurfaceTessellator seabed_tessellator(1.f); // tolerancia en pixeles
+	GeometryRenderer seabed_buffers;
+	Material seabed_material;
+	seabed_material.ka = seabed_material.kd = {.76f,.68f,.5f};
+	seabed_material.ks = {.1f,.1f,.1f};
 	model_angle = .33; view_angle = .85;
 	
 	glm::vec4 light_pos = {2.f,2.f,4.f,0.f};
@@ -127,7 +142,7 @@ int main() {
 			shader_fish.use();
 			shader_fish.setLight(light_pos, glm::vec3{1.f,1.f,1.f}, 0.15f);
 			shader_fish.setUniform("time",t*20);
-			glm::mat4 m = getTransform(spline, t);
+			glm::mat4 m = getTransform(spline, constant_speed ? spline.tAtDistance(t*spline.getLength()) : t);
 			auto mats = common_callbacks::getMatrixes();
 			for(Model &model : fish) {
 				shader_fish.setMatrixes(mats[0]*m,mats[1],mats[2]);
@@ -137,17 +152,40 @@ int main() {
 			}
 		}
 		
+		if (show_crowd) {
+			if (crowd.size()!=crowd_size) crowd.resize(crowd_size);
+			crowd.update(animate ? dt*speed : 0.f, {&spline});
+			Shader &shader_crowd = crowd.getShader();
+			shader_crowd.setLight(light_pos, glm::vec3{1.f,1.f,1.f}, 0.15f);
+			shader_crowd.setUniform("time",t*20);
+			setMatrixes(shader_crowd);
+			crowd.draw(fish);
+		}
+		
 		if (show_spline or show_poly) {
-			setMatrixes(bezier_renderer.getShader());
-			for(const auto & curve : spline.getPieces()) {
-				bezier_renderer.update(curve);
-				glPointSize(1);
-				if (show_spline) bezier_renderer.drawCurve();
+			setMatrixes(spline_renderer.getShader());
+			spline_renderer.update(spline);
+			if (show_spline) spline_renderer.drawCurve();
+			if (show_poly) {
+				spline_renderer.drawPoly();
 				glPointSize(5);
-				if (show_poly) bezier_renderer.drawPoly();
+				spline_renderer.drawPoints();
 			}
 		}
 		
+		if (show_seabed) {
+			// solo se vuelven a evaluar los parches cuyo nivel de detalle cambio con la vista
+			auto ms = common_callbacks::getMatrixes();
+			if (seabed_tessellator.update(seabed,ms[2]*ms[1]*ms[0],glm::vec2(win_width,win_height)) or not seabed_buffers.isOk())
+				seabed_buffers = GeometryRenderer(seabed_tessellator.getGeometry(),true);
+			shader_phong.use();
+			shader_phong.setLight(light_pos, glm::vec3{1.f,1.f,1.f}, 0.15f);
+			setMatrixes(shader_phong);
+			shader_phong.setBuffers(seabed_buffers);
+			shader_phong.setMaterial(seabed_material);
+			seabed_buffers.draw();
+		}
+		
 		if (show_axis) {
 			shader_phong.use();
 			shader_phong.setLight(light_pos, glm::vec3{1.f,1.f,1.f}, 0.15f);
@@ -163,10 +201,15 @@ int main() {
 		// settings sub-window
 		window.ImGuiDialog("CG Example",[&](){
 			ImGui::Checkbox("Pez (P)",&show_fish);
+			ImGui::Checkbox("Cardumen (M)",&show_crowd);
+			if (ImGui::InputInt("Cant. peces",&crowd_size,100,1000))
+				if (crowd_size<0) crowd_size=0;
 			ImGui::Checkbox("Spline (S)",&show_spline);
 			ImGui::Checkbox("Pol. Ctrl. (C)",&show_poly);
+			ImGui::Checkbox("Fondo (F)",&show_seabed);
 			ImGui::Checkbox("Ejes (J)",&show_axis);
 			ImGui::Checkbox("Animar (A)",&animate);
+			ImGui::Checkbox("Vel. constante (V)",&constant_speed);
 			ImGui::SliderFloat("Velocidad",&speed,0.005f,0.5f);
 			ImGui::SliderFloat("T",&t,0.f,1.f);
 			if (ImGui::InputInt("Cant. Pts.",&cant_pts,1,1))
@@ -184,8 +227,11 @@ void characterCallback(GLFWwindow* glfw_win, unsigned int code) {
 		case 'a': case 'A':animate = !animate; break;
 		case 's': case 'S':show_spline = !show_spline; break;
 		case 'p': case 'P':show_fish = !show_fish; break;
+		case 'm': case 'M':show_crowd = !show_crowd; break;
+		case 'f': case 'F':show_seabed = !show_seabed; break;
 		case 'j': case 'J':show_axis = !show_axis; break;
 		case 'c': case 'C':show_poly = !show_poly; break;
+		case 'v': case 'V':constant_speed = !constant_speed; break;
 		case '+': ++cant_pts; break;
 		case '-': --cant_pts; break;
 	}
@@ -0,0 +1,2 @@
+#include "testsBezier.hpp"
+PruebaBezier probar_bezier;
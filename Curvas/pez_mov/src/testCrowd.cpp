@@ -0,0 +1,2 @@
+#include "testsCrowd.hpp"
+PruebaCrowd probar_crowd;
@@ -0,0 +1,2 @@
+#include "testsFlattening.hpp"
+PruebaFlattening probar_flattening;
@@ -0,0 +1,2 @@
+#include "testsSpline.hpp"
+PruebaSpline probar_spline;
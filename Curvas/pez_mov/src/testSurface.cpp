@@ -0,0 +1,2 @@
+#include "testsSurface.hpp"
+PruebaSurface probar_surface;
@@ -0,0 +1,70 @@
+#ifndef TESTSBEZIER_HPP
+#define TESTSBEZIER_HPP
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Bezier.hpp"
+
+#define bez_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de Bezier:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Evaluacion de Beziers de grado 1 a 7: evalMany (Horner), evalUniform
+// (diferencias hacia adelante, con cantidades que no llenan los bloques) y
+// split tienen que dar lo mismo que de Casteljau (at)
+struct PruebaBezier {
+	static bool cerca(const glm::vec3 &a, const glm::vec3 &b, float tol=1e-4f) {
+		return glm::length(a-b)<=tol;
+	}
+	
+	template<int D>
+	static void probar(std::minstd_rand &rng) {
+		std::uniform_real_distribution<float> dist(-1.f,1.f);
+		Bezier<glm::vec3,D> b;
+		for(int j=0;j<=D;++j) b[j] = {dist(rng),dist(rng),dist(rng)};
+		
+		// parametros al azar, y los extremos
+		std::vector<float> ts = {0.f,1.f};
+		for(int i=0;i<200;++i) ts.push_back((dist(rng)+1.f)/2.f);
+		std::vector<glm::vec3> out(ts.size());
+		b.evalMany(ts.data(),ts.size(),out.data());
+		for(size_t i=0;i<ts.size();++i)
+			bez_assert(cerca(out[i],b.at(ts[i])));
+		
+		// equiespaciados
+		for(int n : {1,2,3,31,257,1000}) {
+			std::vector<glm::vec3> u(n);
+			b.evalUniform(n,u.data());
+			bez_assert(u[0]==b[0]);
+			if (n>1) bez_assert(u[n-1]==b[D]);
+			for(int i=1;i<n-1;++i)
+				bez_assert(cerca(u[i],b.at(float(i)/(n-1))));
+		}
+		
+		// split: cada mitad recorre su parte de la curva, y se tocan en t
+		for(float t : {0.5f,0.2f,0.9f}) {
+			Bezier<glm::vec3,D> l, r;
+			b.split(t,l,r);
+			bez_assert(l[0]==b[0] and r[D]==b[D] and l[D]==r[0]);
+			bez_assert(cerca(l[D],b.at(t)));
+			for(int i=0;i<=10;++i) {
+				float s = i/10.f;
+				bez_assert(cerca(l.at(s),b.at(t*s)));
+				bez_assert(cerca(r.at(s),b.at(t+(1.f-t)*s)));
+			}
+		}
+	}
+	
+	PruebaBezier() {
+		std::minstd_rand rng(3);
+		for(int k=0;k<5;++k) {
+			probar<1>(rng); probar<2>(rng); probar<3>(rng); probar<4>(rng);
+			probar<5>(rng); probar<6>(rng); probar<7>(rng);
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef TESTSCROWD_HPP
+#define TESTSCROWD_HPP
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Crowd.hpp"
+#include "Spline.hpp"
+
+#define crowd_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba del cardumen:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Cardumen (CrowdAgents, sin OpenGL): los peces se reparten entre los caminos,
+// agregar peces no cambia los que estaban, update avanza cada uno dando la
+// vuelta al camino, y su matriz es un sistema ortogonal escalado ubicado cerca
+// de su camino, a un costado de la curva (perpendicular a la tangente)
+struct PruebaCrowd {
+	static float distancia(const Spline &s, const glm::vec3 &p) {
+		float d = 1e9f;
+		for(int i=0;i<=4000;++i) d = std::min(d,glm::length(s.at(i/4000.0)-p));
+		return d;
+	}
+
+	PruebaCrowd() {
+		Spline a({{-1.f,0.f,0.f},{0.f,0.f,-1.f},{1.f,0.f,0.f},{0.f,0.f,1.f}},true);
+		Spline b({{10.f,0.f,0.f},{10.f,3.f,0.f},{12.f,3.f,1.f},{12.f,0.f,0.f}},true);
+		std::vector<const Spline*> caminos = {&a,&b};
+		
+		CrowdAgents c(300,2,5);
+		int en_a = 0;
+		for(int i=0;i<c.size();++i) {
+			crowd_assert(c.getPath(i)==0 or c.getPath(i)==1);
+			crowd_assert(c.getPosition(i)>=0.f and c.getPosition(i)<1.f);
+			if (c.getPath(i)==0) ++en_a;
+		}
+		crowd_assert(en_a>50 and en_a<250);
+		
+		// agregar peces no cambia los que ya estaban, y sacarlos tampoco
+		std::vector<float> pos;
+		for(int i=0;i<c.size();++i) pos.push_back(c.getPosition(i));
+		c.resize(500);
+		crowd_assert(c.size()==500 and c.getTransforms().size()==500 and c.getPhases().size()==500);
+		c.resize(200);
+		for(int i=0;i<c.size();++i) crowd_assert(c.getPosition(i)==pos[i]);
+		
+		for(int paso=0;paso<30;++paso) {
+			for(int i=0;i<c.size();++i) pos[i] = c.getPosition(i);
+			c.update(0.07f,caminos);
+			for(int i=0;i<c.size();++i) {
+				// avanza entre 0.7 y 1.3 veces el paso, dando la vuelta
+				float d = c.getPosition(i)-pos[i];
+				if (d<0.f) d += 1.f;
+				crowd_assert(c.getPosition(i)>=0.f and c.getPosition(i)<1.f);
+				crowd_assert(d>0.07f*0.7f-1e-4f and d<0.07f*1.3f+1e-4f);
+				
+				const glm::mat4 &m = c.getTransforms()[i];
+				glm::vec3 x(m[0]), y(m[1]), z(m[2]), o(m[3]);
+				float e = glm::length(x);
+				crowd_assert(e>=0.05f-1e-4f and e<=0.09f+1e-4f);
+				crowd_assert(std::fabs(glm::length(y)-e)<1e-4f and std::fabs(glm::length(z)-e)<1e-4f);
+				crowd_assert(std::fabs(glm::dot(x,y))<1e-4f and std::fabs(glm::dot(x,z))<1e-4f and std::fabs(glm::dot(y,z))<1e-4f);
+				// cerca de su camino (la separacion es gaussiana de desvio 0.12)
+				const Spline &s = *caminos[c.getPath(i)];
+				crowd_assert(distancia(s,o)<1.f);
+				// el punto de la curva del que se separo esta en su posicion
+				glm::vec3 q = s.atDistance(c.getPosition(i)*s.getLength());
+				crowd_assert(std::fabs(glm::dot(o-q,x/e))<1e-3f);
+			}
+		}
+	}
+};
+
+#endif
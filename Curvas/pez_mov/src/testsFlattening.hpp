@@ -0,0 +1,82 @@
+#ifndef TESTSFLATTENING_HPP
+#define TESTSFLATTENING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Bezier.hpp"
+#include "CurveFlattening.hpp"
+#include "Spline.hpp"
+
+#define flat_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de CurveFlattening:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// CurveFlattening: un tramo recto da dos vertices, uno curvo queda a menos de
+// la tolerancia (en pixeles) de la curva y con menos tolerancia tiene mas
+// vertices, las piezas encadenadas no repiten vertices, y lo que queda detras
+// de la camara no se parte (o se parte solo donde cruza el plano de la camara)
+struct PruebaFlattening {
+	// maxima distancia en pixeles de la curva a la polilinea (con la matriz
+	// identidad y un viewport de 800x600, x e y de [-1,1] se escalan por 400 y 300)
+	static float error(const Bezier<> &b, const std::vector<glm::vec3> &v) {
+		float emax = 0.f;
+		for(int i=0;i<=500;++i) {
+			glm::vec3 p = b.at(i/500.f);
+			glm::vec2 q(p.x*400.f,p.y*300.f);
+			float dmin = 1e9f;
+			for(size_t k=0;k+1<v.size();++k) {
+				glm::vec2 a(v[k].x*400.f,v[k].y*300.f), c(v[k+1].x*400.f,v[k+1].y*300.f), ac = c-a;
+				float l2 = glm::dot(ac,ac);
+				float u = l2>0.f ? std::min(1.f,std::max(0.f,glm::dot(q-a,ac)/l2)) : 0.f;
+				dmin = std::min(dmin,glm::length(q-(a+ac*u)));
+			}
+			emax = std::max(emax,dmin);
+		}
+		return emax;
+	}
+	
+	PruebaFlattening() {
+		glm::mat4 id(1.f);
+		glm::vec2 vp(800.f,600.f);
+		Bezier<> recta({{-1.f,0.f,0.f},{-0.3f,0.f,0.f},{0.3f,0.f,0.f},{1.f,0.f,0.f}});
+		Bezier<> curva({{-1.f,0.f,0.f},{-1.f,1.f,0.f},{1.f,1.f,0.f},{1.f,0.f,0.f}});
+		
+		size_t anterior = 0;
+		for(float tol : {2.f,0.5f,0.1f}) {
+			CurveFlattening f(id,vp,tol);
+			std::vector<glm::vec3> r, c;
+			f.flatten(recta,r);
+			f.flatten(curva,c);
+			flat_assert(r.size()==2 and r[0]==recta[0] and r[1]==recta[3]);
+			flat_assert(c.front()==curva[0] and c.back()==curva[3]);
+			flat_assert(error(curva,c)<=tol*1.01f);
+			flat_assert(c.size()>anterior);
+			anterior = c.size();
+		}
+		
+		// una spline cerrada: un solo strip, que termina donde empieza y sin
+		// vertices repetidos donde se unen las piezas
+		Spline s({{-0.5f,-0.5f,0.f},{0.5f,-0.5f,0.f},{0.5f,0.5f,0.f},{-0.5f,0.5f,0.f}},true);
+		std::vector<glm::vec3> v;
+		CurveFlattening(id,vp,0.5f).flattenAll(s.getPieces(),v);
+		flat_assert(v.front()==v.back());
+		for(size_t k=0;k+1<v.size();++k)
+			flat_assert(v[k]!=v[k+1]);
+		
+		// camara en el origen mirando hacia -z (w = -z)
+		glm::mat4 mvp(1.f); mvp[2][3] = -1.f; mvp[3][3] = 0.f;
+		Bezier<> atras({{-1.f,0.f,5.f},{0.f,1.f,6.f},{1.f,0.f,5.f},{2.f,1.f,7.f}});
+		Bezier<> cruza({{-1.f,0.f,5.f},{0.f,1.f,-6.f},{1.f,0.f,5.f},{2.f,1.f,-7.f}});
+		std::vector<glm::vec3> a, x;
+		CurveFlattening(mvp,vp,0.5f).flatten(atras,a);
+		CurveFlattening(mvp,vp,0.5f).flatten(cruza,x);
+		flat_assert(a.size()==2);
+		flat_assert(x.size()<=size_t(8*CurveFlattening::max_depth));
+	}
+};
+
+#endif
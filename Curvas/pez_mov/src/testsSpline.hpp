@@ -0,0 +1,167 @@
+#ifndef TESTSSPLINE_HPP
+#define TESTSSPLINE_HPP
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Spline.hpp"
+
+#define spl_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de Spline:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Spline: setControlPoint cambia la version solo de las piezas que toca (con
+// eso SplineRenderer sabe cuales volver a teselar y subir), un punto de union
+// queda igual en las dos piezas, y las versiones no se repiten entre splines;
+// la longitud de arco coincide con la de una polilinea muy fina (tambien
+// despues de mover un punto), tAtDistance es monotona y entre dos distancias
+// queda un arco de la longitud de su diferencia; frameAt es ortonormal, con
+// la tangente y la posicion de la curva, no gira en una curva plana (aunque la
+// tangente quede vertical), varia de a poco y en una cerrada cierra
+struct PruebaSpline {
+	static bool cerca(const glm::vec3 &a, const glm::vec3 &b, float tol) {
+		return glm::length(a-b)<=tol;
+	}
+	// pruebas de los sistemas de referencia de s; si normal_plano no es nulo,
+	// s esta en un plano y el sistema no puede girar fuera de el
+	static void probarFrames(const Spline &s, glm::vec3 normal_plano) {
+		const int n = 2000;
+		glm::mat4 ant = s.frameAt(0.0);
+		for(int i=0;i<=n;++i) {
+			double t = double(i)/n;
+			glm::mat4 m = s.frameAt(t);
+			glm::vec3 x(m[0]), y(m[1]), z(m[2]), d;
+			spl_assert(cerca(glm::vec3(m[3]),s.at(t,d),1e-5f));
+			spl_assert(std::fabs(glm::length(x)-1.f)<1e-4f and std::fabs(glm::length(y)-1.f)<1e-4f);
+			spl_assert(std::fabs(glm::dot(x,y))<1e-4f and cerca(z,glm::cross(x,y),1e-4f));
+			if (glm::length(d)>1e-3f) spl_assert(cerca(x,glm::normalize(d),1e-4f));
+			// en una plana la normal o la binormal es siempre la del plano
+			if (glm::length(normal_plano)>0.f) {
+				spl_assert(std::fabs(std::fabs(glm::dot(y,normal_plano))+std::fabs(glm::dot(z,normal_plano))-1.f)<1e-3f);
+				spl_assert(std::fabs(glm::dot(y,normal_plano)-glm::dot(glm::vec3(ant[1]),normal_plano))<1e-3f);
+			}
+			// de una muestra a la siguiente la normal casi no cambia (salvo en
+			// las uniones, donde puede cambiar la tangente)
+			double u = t*s.getPieces().size();
+			if (i>0 and std::fabs(u-std::round(u))*n>s.getPieces().size())
+				spl_assert(cerca(glm::vec3(m[1]),glm::vec3(ant[1]),0.1f));
+			ant = m;
+		}
+		if (s.IsClosed()) {
+			glm::mat4 a = s.frameAt(0.0), b = s.frameAt(1.0);
+			for(int k=0;k<4;++k) spl_assert(cerca(glm::vec3(a[k]),glm::vec3(b[k]),1e-4f));
+		}
+	}
+
+	// longitud de la polilinea de n tramos iguales en t, entre t0 y t1
+	static double largoPolilinea(const Spline &s, int n, double t0=0.0, double t1=1.0) {
+		double l = 0.0;
+		glm::vec3 a = s.at(t0);
+		for(int i=1;i<=n;++i) {
+			glm::vec3 b = s.at(t0+(t1-t0)*i/n);
+			l += glm::length(b-a);
+			a = b;
+		}
+		return l;
+	}
+	// pruebas de longitud de arco sobre s
+	static void probarLongitud(const Spline &s) {
+		double largo = s.getLength();
+		spl_assert(std::fabs(largo-largoPolilinea(s,20000))<1e-4*largo);
+		const int n = 500;
+		double t_ant = -1.0, h = largo/n;
+		// (en una cerrada s=largo ya es la vuelta siguiente, t=0)
+		for(int i=0;i<=(s.IsClosed()?n-1:n);++i) {
+			double t = s.tAtDistance(i*h);
+			spl_assert(t>=t_ant);
+			t_ant = t;
+			// la cuerda no puede ser mas larga que el arco
+			if (i<n) spl_assert(glm::length(s.atDistance((i+1)*h)-s.atDistance(i*h))<=h*(1+1e-4));
+		}
+		// el arco entre dos distancias
+		for(int i=1;i<10;++i) {
+			double s0 = largo*i/20, s1 = largo*(i+9)/20;
+			double l = largoPolilinea(s,5000,s.tAtDistance(s0),s.tAtDistance(s1));
+			spl_assert(std::fabs(l-(s1-s0))<1e-3*largo);
+		}
+		spl_assert(s.tAtDistance(0.0)==0.0);
+		if (s.IsClosed()) {
+			spl_assert(std::fabs(s.tAtDistance(largo*0.3+largo)-s.tAtDistance(largo*0.3))<1e-9);
+			spl_assert(std::fabs(s.tAtDistance(-largo*0.3)-s.tAtDistance(largo*0.7))<1e-9);
+		} else {
+			spl_assert(std::fabs(s.tAtDistance(largo)-1.0)<1e-9);
+			spl_assert(s.tAtDistance(2*largo)==s.tAtDistance(largo) and s.tAtDistance(-1.0)==0.0);
+		}
+	}
+
+	// las versiones de las piezas que cambiaron entre antes y s
+	static std::vector<int> cambiadas(const std::vector<int> &antes, const Spline &s) {
+		std::vector<int> c;
+		for(int i=0;i<static_cast<int>(antes.size());++i)
+			if (s.getPieceVersion(i)!=antes[i]) c.push_back(i);
+		return c;
+	}
+	static std::vector<int> versiones(const Spline &s) {
+		std::vector<int> v;
+		for(size_t i=0;i<s.getPieces().size();++i) v.push_back(s.getPieceVersion(i));
+		return v;
+	}
+	
+	PruebaSpline() {
+		std::vector<glm::vec3> pts = {{0.f,0.f,0.f},{1.f,0.f,0.f},{1.f,1.f,0.f},{0.f,1.f,0.f},{0.f,2.f,0.f}};
+		Spline a(pts,false), c(pts,true);
+		spl_assert(a.getPieces().size()==4 and c.getPieces().size()==5);
+		spl_assert(a.getControlPointsCount()==13 and c.getControlPointsCount()==15);
+		spl_assert(a.getPieceVersion(0)!=c.getPieceVersion(0));
+		
+		// un punto interior de una pieza: solo esa
+		auto v = versiones(a);
+		a.setControlPoint(4,{2.f,0.5f,0.f});
+		spl_assert(cambiadas(v,a)==std::vector<int>{1});
+		spl_assert(a.getPieces()[1][1]==glm::vec3(2.f,0.5f,0.f));
+		// una union: las dos piezas, con el mismo punto
+		v = versiones(a);
+		a.setControlPoint(6,{1.5f,1.5f,0.f});
+		spl_assert((cambiadas(v,a)==std::vector<int>{1,2}));
+		spl_assert(a.getPieces()[1][3]==a.getPieces()[2][0]);
+		spl_assert(a.getControlPoint(6)==glm::vec3(1.5f,1.5f,0.f));
+		// los extremos de una abierta: solo la primera o la ultima
+		v = versiones(a);
+		a.setControlPoint(0,{-1.f,0.f,0.f});
+		spl_assert(cambiadas(v,a)==std::vector<int>{0});
+		v = versiones(a);
+		a.setControlPoint(12,{0.f,3.f,0.f});
+		spl_assert(cambiadas(v,a)==std::vector<int>{3});
+		spl_assert(a.at(1.0)==glm::vec3(0.f,3.f,0.f));
+		// en una cerrada el primero es tambien el final de la ultima
+		v = versiones(c);
+		c.setControlPoint(0,{-1.f,0.f,0.f});
+		spl_assert((cambiadas(v,c)==std::vector<int>{0,4}));
+		spl_assert(c.getPieces()[4][3]==c.getPieces()[0][0]);
+		
+		// longitud de arco, con piezas de largos muy distintos
+		Spline d({{0.f,0.f,0.f},{0.1f,0.f,0.f},{3.f,2.f,0.f},{3.f,2.2f,1.f},{-2.f,1.f,0.f}},false);
+		probarLongitud(d);
+		d.setControlPoint(7,{5.f,0.f,-1.f});
+		probarLongitud(d);
+		probarLongitud(c);
+		
+		// frames: curvas planas con tangentes verticales (en el plano xy), plana
+		// horizontal, y una helice cerrada (sin cuspides, donde la tangente se da
+		// vuelta y el giro minimo no esta definido)
+		Spline vert({{0.f,0.f,0.f},{0.f,2.f,0.f},{1.f,3.f,0.f},{2.f,2.f,0.f},{2.f,-1.f,0.f}},false);
+		probarFrames(vert,{0.f,0.f,1.f});
+		Spline xy({{0.f,0.f,0.f},{2.f,0.f,0.f},{2.f,1.f,0.f},{0.f,1.5f,0.f}},true);
+		probarFrames(xy,{0.f,0.f,1.f});
+		Spline hz({{0.f,0.f,0.f},{1.f,0.f,1.f},{3.f,0.f,0.f},{1.f,0.f,-2.f}},true);
+		probarFrames(hz,{0.f,1.f,0.f});
+		std::vector<glm::vec3> hel;
+		for(int i=0;i<12;++i) hel.push_back({std::cos(i*0.5f),0.3f*i,std::sin(i*0.5f)});
+		Spline h(hel,true);
+		probarFrames(h,glm::vec3(0.f));
+	}
+};
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef TESTSSURFACE_HPP
+#define TESTSSURFACE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Bezier.hpp"
+#include "BezierPatch.hpp"
+#include "BSplineSurface.hpp"
+#include "SurfaceTessellator.hpp"
+
+#define surf_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de BSplineSurface:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// BezierPatch evalua lo mismo que las curvas de Bezier por filas o por
+// columnas (y evalGrid lo mismo que at), los parches vecinos de BSplineSurface
+// comparten los bordes exactamente, setControlPoint solo cambia los parches
+// que tocan, y SurfaceTessellator no deja grietas entre parches con distinto
+// nivel de detalle ni vuelve a evaluar lo que no cambio
+struct PruebaSurface {
+	static bool cerca(glm::vec3 a, glm::vec3 b, float tol=1e-4f) {
+		return glm::length(a-b)<=tol*(1.f+glm::length(a));
+	}
+	
+	// distancia de p a la polilinea v
+	static float distancia(glm::vec3 p, const std::vector<glm::vec3> &v) {
+		float dmin = glm::length(p-v[0]);
+		for(size_t k=0;k+1<v.size();++k) {
+			glm::vec3 ac = v[k+1]-v[k];
+			float l2 = glm::dot(ac,ac);
+			float u = l2>0.f ? std::min(1.f,std::max(0.f,glm::dot(p-v[k],ac)/l2)) : 0.f;
+			dmin = std::min(dmin,glm::length(p-(v[k]+ac*u)));
+		}
+		return dmin;
+	}
+	
+	// los vertices de un borde de la malla de un parche (n+1)x(n+1) que empieza
+	// en base: 0 es v=0, 1 es u=1, 2 es v=1, 3 es u=0 (como en SurfaceTessellator)
+	static std::vector<glm::vec3> borde(const Geometry &g, int base, int n, int k) {
+		std::vector<glm::vec3> v(n+1);
+		int s = n+1;
+		for(int c=0;c<=n;++c)
+			v[c] = g.positions[base+(k==0 ? c*s : (k==1 ? n*s+c : (k==2 ? c*s+n : c)))];
+		return v;
+	}
+	
+	static void probarParche() {
+		BezierPatch<glm::vec3,3> bp;
+		for(int i=0;i<=3;++i)
+			for(int j=0;j<=3;++j)
+				bp[i][j] = glm::vec3(i+.3f*j,j-.2f*i*i,std::sin(1.f+i*j)+.5f*i);
+		for(int a=0;a<=8;++a) {
+			for(int b=0;b<=8;++b) {
+				float u = a/8.f, v = b/8.f;
+				// producto tensorial: primero en u y despues en v da lo mismo
+				Bezier<glm::vec3,3> c;
+				for(int j=0;j<=3;++j) c[j] = bp.column(j).at(u);
+				glm::vec3 du, dv, p = bp.at(u,v,du,dv);
+				surf_assert(cerca(bp.at(u,v),c.at(v)) && cerca(p,c.at(v)));
+				// derivadas contra diferencias finitas
+				const float h = 1e-3f;
+				glm::vec3 fu = (bp.at(u+h,v)-bp.at(u-h,v))/(2*h), fv = (bp.at(u,v+h)-bp.at(u,v-h))/(2*h);
+				surf_assert(cerca(du,fu,1e-2f) && cerca(dv,fv,1e-2f));
+			}
+		}
+		// los bordes son las curvas de las filas/columnas extremas
+		surf_assert(cerca(bp.at(0.f,.37f),bp.row(0).at(.37f)) && cerca(bp.at(1.f,.37f),bp.row(3).at(.37f)));
+		surf_assert(cerca(bp.at(.61f,0.f),bp.column(0).at(.61f)) && cerca(bp.at(.61f,1.f),bp.column(3).at(.61f)));
+		// evalGrid, con y sin derivadas, y con grillas no cuadradas
+		for(int nu : {1,2,5,17}) {
+			for(int nv : {1,3,9}) {
+				std::vector<glm::vec3> pos(nu*nv), du(nu*nv), dv(nu*nv), pos2(nu*nv);
+				bp.evalGrid(nu,nv,pos.data(),du.data(),dv.data());
+				bp.evalGrid(nu,nv,pos2.data());
+				for(int a=0;a<nu;++a) {
+					for(int b=0;b<nv;++b) {
+						float u = nu>1 ? a/float(nu-1) : 0.f, v = nv>1 ? b/float(nv-1) : 0.f;
+						glm::vec3 eu, ev, p = bp.at(u,v,eu,ev);
+						surf_assert(cerca(pos[a*nv+b],p) && cerca(pos2[a*nv+b],p));
+						surf_assert(cerca(du[a*nv+b],eu) && cerca(dv[a*nv+b],ev));
+					}
+				}
+			}
+		}
+	}
+	
+	// una red ondulada de nu x nv puntos, que se aleja de la camara (en z<0)
+	static std::vector<glm::vec3> red(int nu, int nv) {
+		std::vector<glm::vec3> pts(nu*nv);
+		for(int i=0;i<nu;++i)
+			for(int j=0;j<nv;++j)
+				pts[i*nv+j] = glm::vec3(j*.5f-nv*.25f,-1.f+.4f*std::sin(i*1.3f+j*.7f),-1.5f-i*.8f);
+		return pts;
+	}
+	
+	static void probarBSpline(bool closed_u, bool closed_v) {
+		const int nu = 9, nv = 7;
+		BSplineSurface s(nu,nv,red(nu,nv),closed_u,closed_v);
+		const int pu = s.getPatchesCountU(), pv = s.getPatchesCountV();
+		surf_assert(pu==(closed_u ? nu : nu-3) && pv==(closed_v ? nv : nv-3));
+		surf_assert(int(s.getPatches().size())==pu*pv);
+		// bordes compartidos: iguales bit a bit (incluso al cerrar la red)
+		auto &ps = s.getPatches();
+		for(int a=0;a<pu;++a) {
+			for(int b=0;b<pv;++b) {
+				const auto &p = ps[a*pv+b];
+				if (a+1<pu or closed_u) {
+					const auto &q = ps[((a+1)%pu)*pv+b];
+					for(int j=0;j<=3;++j) surf_assert(p[3][j]==q[0][j]);
+				}
+				if (b+1<pv or closed_v) {
+					const auto &q = ps[a*pv+(b+1)%pv];
+					for(int i=0;i<=3;++i) surf_assert(p[i][3]==q[i][0]);
+				}
+			}
+		}
+		// un punto de control de la red cambia a lo sumo 4x4 parches, y despues
+		// los parches quedan iguales a los de una superficie nueva con esa red
+		std::vector<int> antes(pu*pv);
+		for(int k=0;k<pu*pv;++k) antes[k] = s.getPatchVersion(k);
+		glm::vec3 nuevo(.3f,2.f,-4.f);
+		s.setControlPoint(4,2,nuevo);
+		std::vector<glm::vec3> pts = red(nu,nv);
+		pts[4*nv+2] = nuevo;
+		BSplineSurface s2(nu,nv,pts,closed_u,closed_v);
+		int cambiados = 0;
+		for(int a=0;a<pu;++a) {
+			for(int b=0;b<pv;++b) {
+				int k = a*pv+b;
+				// la ventana del parche (a,b) son las filas a..a+3 y columnas b..b+3
+				bool toca = (4-a+nu)%nu<4 && (2-b+nv)%nv<4;
+				if (s.getPatchVersion(k)!=antes[k]) ++cambiados;
+				surf_assert(toca == (s.getPatchVersion(k)!=antes[k]));
+				for(int i=0;i<=3;++i)
+					for(int j=0;j<=3;++j)
+						surf_assert(cerca(ps[k][i][j],s2.getPatches()[k][i][j]));
+			}
+		}
+		surf_assert(cambiados>0 && cambiados<=16);
+		surf_assert(s.getControlPoint(4,2)==nuevo);
+	}
+	
+	static void probarTeselado() {
+		const int nu = 12, nv = 7;
+		BSplineSurface s(nu,nv,red(nu,nv));
+		const int pu = s.getPatchesCountU(), pv = s.getPatchesCountV();
+		// perspectiva mirando hacia -z (clip.w = -z): lo cercano se ve grande y
+		// tiene mas detalle que lo lejano
+		glm::mat4 mvp(1.f);
+		mvp[2][3] = -1.f; mvp[3][3] = 0.f;
+		SurfaceTessellator st(1.f,6);
+		surf_assert(st.update(s,mvp,glm::vec2(800.f,600.f)));
+		surf_assert(st.patchesEvaluated()==pu*pv);
+		const Geometry &g = st.getGeometry();
+		
+		// cada parche empieza donde tex_coords es (0,0); de (0,1/n) sale su n
+		std::vector<int> base, niv;
+		for(size_t i=0;i<g.tex_coords.size();) {
+			surf_assert(g.tex_coords[i].x==0.f && g.tex_coords[i].y==0.f);
+			int n = std::lround(1.f/g.tex_coords[i+1].y);
+			surf_assert((n&(n-1))==0 && n<=64);
+			base.push_back(i); niv.push_back(n);
+			i += (n+1)*(n+1);
+		}
+		surf_assert(int(base.size())==pu*pv && g.positions.size()==g.tex_coords.size());
+		surf_assert(*std::min_element(niv.begin(),niv.end()) < *std::max_element(niv.begin(),niv.end()));
+		
+		// los vertices de cada parche estan sobre el parche (los de los bordes,
+		// sobre la polilinea del borde; los de adentro, en su lugar de la grilla)
+		for(int k=0;k<pu*pv;++k) {
+			int n = niv[k], sz = n+1;
+			const auto &p = s.getPatches()[k];
+			for(int a=1;a<n;++a)
+				for(int b=1;b<n;++b)
+					surf_assert(cerca(g.positions[base[k]+a*sz+b],p.at(float(a)/n,float(b)/n)));
+			surf_assert(cerca(g.positions[base[k]],p.at(0.f,0.f)) && cerca(g.positions[base[k]+n*sz+n],p.at(1.f,1.f)));
+		}
+		
+		// sin grietas: en cada borde compartido, cada vertice de un lado esta
+		// sobre la polilinea del otro (y al reves), aunque tengan distinto nivel
+		int distintos = 0;
+		for(int a=0;a<pu;++a) {
+			for(int b=0;b<pv;++b) {
+				int k = a*pv+b;
+				for(int lado=0;lado<2;++lado) {
+					if (lado==0 ? a+1>=pu : b+1>=pv) continue;
+					int k2 = lado==0 ? k+pv : k+1;
+					// u=1 de k con u=0 del de abajo, v=1 de k con v=0 del de la derecha
+					std::vector<glm::vec3> e1 = borde(g,base[k],niv[k],lado==0 ? 1 : 2);
+					std::vector<glm::vec3> e2 = borde(g,base[k2],niv[k2],lado==0 ? 3 : 0);
+					if (niv[k]!=niv[k2]) ++distintos;
+					surf_assert(e1.front()==e2.front() && e1.back()==e2.back());
+					for(const glm::vec3 &p : e1) surf_assert(distancia(p,e2)<1e-5f);
+					for(const glm::vec3 &p : e2) surf_assert(distancia(p,e1)<1e-5f);
+				}
+			}
+		}
+		surf_assert(distintos>0);
+		
+		// la misma camara no reevalua nada; mover un punto reevalua solo los
+		// parches que toca
+		surf_assert(!st.update(s,mvp,glm::vec2(800.f,600.f)));
+		surf_assert(st.patchesEvaluated()==pu*pv);
+		s.setControlPoint(6,3,s.getControlPoint(6,3)+glm::vec3(0.f,.2f,0.f));
+		surf_assert(st.update(s,mvp,glm::vec2(800.f,600.f)));
+		int evaluados = st.patchesEvaluated()-pu*pv;
+		surf_assert(evaluados>0 && evaluados<=16);
+	}
+	
+	PruebaSurface() {
+		probarParche();
+		probarBSpline(false,false);
+		probarBSpline(true,false);
+		probarBSpline(false,true);
+		probarBSpline(true,true);
+		probarTeselado();
+	}
+};
+
+#endif
@@ -0,0 +1,49 @@
+#version 330 core
+
+in vec3 vertexPosition;
+in vec3 vertexNormal;
+in int vertexTriangle; // triangulo de delaunay0 en el que cae el vertice
+in vec3 vertexWeights; // coordenadas baricentricas en ese triangulo
+
+uniform isamplerBuffer triangles0; // 3 indices de puntos por triangulo de delaunay0
+uniform samplerBuffer points0; // (x,y) de los puntos de delaunay0
+uniform samplerBuffer points1; // (x,y) de los puntos de delaunay1
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+uniform vec4 lightPosition;
+
+// salidas de phong.vert y wireframe.vert, para usarlo con cualquiera de los dos .frag
+out vec3 fragPosition;
+out vec3 fragNormal;
+out vec4 lightVSPosition;
+out float colorDecay;
+
+void main() {
+	int i0 = texelFetch(triangles0,3*vertexTriangle+0).r;
+	int i1 = texelFetch(triangles0,3*vertexTriangle+1).r;
+	int i2 = texelFetch(triangles0,3*vertexTriangle+2).r;
+	vec2 q0 = texelFetch(points1,i0).xy, q1 = texelFetch(points1,i1).xy, q2 = texelFetch(points1,i2).xy;
+	
+	// la deformacion es 2D: se interpola (x,y) en delaunay1 y se conserva z
+	vec2 xy = vertexWeights.x*q0 + vertexWeights.y*q1 + vertexWeights.z*q2;
+	vec3 position = vec3(xy,vertexPosition.z);
+	
+	// dentro de cada triangulo la deformacion es afin, asi que las normales se
+	// transforman con la inversa transpuesta de su jacobiano
+	vec2 p0 = texelFetch(points0,i0).xy, p1 = texelFetch(points0,i1).xy, p2 = texelFetch(points0,i2).xy;
+	mat2 P = mat2(p1-p0,p2-p0), Q = mat2(q1-q0,q2-q0);
+	vec3 normal = vertexNormal;
+	if (abs(determinant(P))>1e-12 && abs(determinant(Q))>1e-12) {
+		mat2 J = Q*inverse(P);
+		mat3 Jn = transpose(inverse(mat3(vec3(J[0],0.f),vec3(J[1],0.f),vec3(0.f,0.f,1.f))));
+		normal = normalize(Jn*vertexNormal);
+	}
+	
+	gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(position,1.f);
+	fragPosition = vec3(modelMatrix * vec4(position,1.f));
+	fragNormal = mat3(transpose(inverse(viewMatrix*modelMatrix))) * normal;
+	lightVSPosition = viewMatrix * lightPosition;
+	colorDecay = fragNormal.z<0.f ? .75f : 1.f;
+}
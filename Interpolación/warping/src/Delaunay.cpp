@@ -1,5 +1,12 @@
+#include <algorithm>
 #include <unordered_set>
+#include <queue>
+#include <deque>
+#include <random>
+#include <cstdint>
+#include <cmath>
 #include "Delaunay.hpp"
+#include "Predicados.hpp"
 #include "Debug.hpp"
 
 //static void verificarIntegridad(const Delaunay &d) {
@@ -14,8 +21,15 @@
 //	}
 //}
 
+int Delaunay::ultima_version = 0;
+
+// > 0 si c esta a la izquierda de la recta ab, < 0 si esta a la derecha (signo exacto)
+static double orientacion(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c) {
+	return orient2d(a.x,a.y,b.x,b.y,c.x,c.y);
+}
+
 Delaunay::Delaunay(glm::vec3 punto1, glm::vec3 punto2, float tol)
-	: error_tol(tol), boundingBox(punto1, punto2)
+	: error_tol(tol), version(++ultima_version), boundingBox(punto1, punto2)
 {
 	// registrar esos cuatro puntos
 	puntos.push_back({boundingBox.pmax.x,boundingBox.pmax.y,0.f});
@@ -43,13 +57,20 @@ void Delaunay::intercambiarDiagonales(int i_tri1, int i_tri2) {
 	tri1.vertices[(indice1+2)%3] = tri2.vertices[indice2];
 	tri2.vertices[(indice2+2)%3] = tri1.vertices[indice1];
 	
-	// reacomodar los vecinos de los triangulos 1 y 2
+	// reacomodar los vecinos de los triangulos 1 y 2 (y las marcas de segmento,
+	// que van con las aristas; la diagonal nueva no es un segmento)
 	int vecino1 = tri1.vecinos[(indice1+1)%3];
 	int vecino2 = tri2.vecinos[(indice2+1)%3];
+	bool fija1 = tri1.restringida[(indice1+1)%3];
+	bool fija2 = tri2.restringida[(indice2+1)%3];
 	tri1.vecinos[indice1] = vecino2;
 	tri1.vecinos[(indice1+1)%3] = i_tri2;
 	tri2.vecinos[indice2] = vecino1;
 	tri2.vecinos[(indice2+1)%3] = i_tri1;
+	tri1.restringida[indice1] = fija2;
+	tri1.restringida[(indice1+1)%3] = false;
+	tri2.restringida[indice2] = fija1;
+	tri2.restringida[(indice2+1)%3] = false;
 	
 	// reacomodar los vecinos de los vecinos de los triangulos 1 y 2
 	if (vecino1!=-1) triangulos[vecino1].reemplazarVecino(i_tri1,i_tri2);
@@ -62,13 +83,76 @@ int Delaunay::agregarPunto(glm::vec3 punto) {
 	if (!boundingBox.contiene(punto)) return -1;
 	int indice = puntos.size();
 	puntos.push_back(punto);
-	conectarPunto(indice);
+	actualizarGrilla(indice,conectarPunto(indice));
 	return indice;
 }
+
+// distancia a lo largo de la curva de Hilbert de orden 16 de la celda (x,y)
+static uint32_t distanciaHilbert(uint32_t x, uint32_t y) {
+	uint32_t d = 0;
+	for (uint32_t s=1u<<15; s>0; s>>=1) {
+		uint32_t rx = (x&s)>0, ry = (y&s)>0;
+		d += s*s*((3*rx)^ry);
+		// rotar el cuadrante para que la curva quede continua
+		if (ry==0) {
+			if (rx==1) { x = s-1-x; y = s-1-y; }
+			std::swap(x,y);
+		}
+	}
+	return d;
+}
+
+std::vector<int> Delaunay::agregarPuntos(const std::vector<glm::vec3> &nuevos) {
+	std::vector<int> indices(nuevos.size(),-1);
+	
+	// registrar todos los puntos validos (en el orden original, para que los
+	// indices no dependan del orden de insercion) y calcular su clave de Hilbert
+	glm::vec3 tam = boundingBox.pmax-boundingBox.pmin;
+	float ex = tam.x>0 ? 65535.f/tam.x : 0.f, ey = tam.y>0 ? 65535.f/tam.y : 0.f;
+	std::vector<std::pair<uint32_t,int>> orden; // (clave, indice en puntos)
+	orden.reserve(nuevos.size());
+	puntos.reserve(puntos.size()+nuevos.size());
+	for(size_t i=0;i<nuevos.size();++i) {
+		glm::vec3 p = nuevos[i];
+		if (!boundingBox.contiene(p)) continue;
+		indices[i] = puntos.size();
+		puntos.push_back(p);
+		uint32_t x = (p.x-boundingBox.pmin.x)*ex, y = (p.y-boundingBox.pmin.y)*ey;
+		orden.emplace_back(distanciaHilbert(x,y),indices[i]);
+	}
+	triangulos.reserve(triangulos.size()+2*orden.size());
+	
+	// BRIO: mezclar al azar y partir en rondas que duplican su tamanio (la
+	// ultima tiene la mitad de los puntos), ordenando cada ronda por Hilbert;
+	// el azar entre rondas evita los peores casos de insertar en orden
+	std::minstd_rand rng(orden.size());
+	std::shuffle(orden.begin(),orden.end(),rng);
+	std::vector<size_t> fin_ronda;
+	for(size_t f=orden.size(); f>0; f/=2) {
+		fin_ronda.push_back(f);
+		if (f<=64) break;
+	}
+	size_t ini = 0;
+	for(auto it=fin_ronda.rbegin();it!=fin_ronda.rend();++it) {
+		std::sort(orden.begin()+ini,orden.begin()+*it);
+		ini = *it;
+	}
+	
+	// insertar, arrancando cada busqueda desde el triangulo del punto anterior
+	// (la grilla no se usa ni se toca mientras tanto: puntos ya tiene todos los
+	// nuevos, y con ese tamanio se rehace una sola vez, al final)
+	int i_tri = 0;
+	for(const auto &o : orden)
+		i_tri = conectarPunto(o.second,i_tri);
+	rehacerGrilla();
+	return indices;
+}
 	
-int Delaunay::conectarPunto(int i_pto) {
+int Delaunay::conectarPunto(int i_pto, int i_inicio) {
+	version = ++ultima_version;
 	// buscar que triangulo dividir
-	int i_triangulote = enQueTriangulo(puntos[i_pto]); 
+	int i_triangulote = i_inicio==-1 ? enQueTriangulo(puntos[i_pto])
+		                             : enQueTriangulo(puntos[i_pto],i_inicio);
 	Triangulo triangulote = triangulos[i_triangulote];
 	
 	// crear los tres triangulitos que reemplazaran a triangulote
@@ -83,6 +167,11 @@ int Delaunay::conectarPunto(int i_pto) {
 	Triangulo &triangulito2 = triangulos[i_triangulito2];
 	Triangulo &triangulito3 = triangulos[i_triangulito3];
 	
+	// las aristas de triangulote siguen siendo segmentos si lo eran
+	triangulito1.restringida[0]=triangulote.restringida[1];
+	triangulito2.restringida[0]=triangulote.restringida[0];
+	triangulito3.restringida[0]=triangulote.restringida[2];
+	
 	// acomodar los vecinos de los nuevos triangulitos
 	triangulito1.vecinos[0]=triangulote.vecinos[1];
 	triangulito1.vecinos[1]=i_triangulito3;
@@ -102,124 +191,466 @@ int Delaunay::conectarPunto(int i_pto) {
 	reemplazar_vecino(triangulote.vecinos[1],i_triangulote,i_triangulito1);
 	reemplazar_vecino(triangulote.vecinos[2],i_triangulote,i_triangulito3);
 	
+	// si el punto cayo justo sobre una arista interior, el triangulito de ese
+	// lado queda con area nula: se intercambia ya su diagonal con el vecino (asi
+	// quedan partidos los dos triangulos de la arista), porque con tolerancia
+	// recuperarDelaunay podria no hacerlo; si esa arista era un segmento, queda
+	// partido en dos por el punto
+	std::vector<int> para_revisar = {i_triangulito1,i_triangulito2,i_triangulito3};
+	for(int i_tri : {i_triangulito1,i_triangulito2,i_triangulito3}) { 
+		const Triangulo &t = triangulos[i_tri];
+		int i_vec = t.vecinos[0]; // el opuesto al punto
+		if (i_vec!=-1 and orientacion(puntos[t[0]],puntos[t[1]],puntos[t[2]])==0) {
+			int b = t[1], c = t[2];
+			bool partir = t.restringida[0];
+			intercambiarDiagonales(i_tri,i_vec);
+			para_revisar.push_back(i_vec);
+			if (partir) {
+				marcarArista(i_pto,b,true);
+				marcarArista(i_pto,c,true);
+			}
+		}
+	}
+	
 	// retriangular correctamente
-	recuperarDelaunay({i_triangulito1,i_triangulito2,i_triangulito3});
+	recuperarDelaunay(para_revisar);
 	
-	return puntos.size()-1;
+	return i_triangulote;
+}
+
+void Delaunay::actualizarGrilla(int i_pto, int i_tri) {
+	if (static_cast<int>(puntos.size())>8*grilla_n*grilla_n) rehacerGrilla();
+	else grilla[celda(puntos[i_pto])] = i_tri;
 }
 
-void Delaunay::moverPunto(int indice, glm::vec3 destino){
-	cg_assert(indice>=0 and indice<puntos.size(),"indice de punto no valido");
-	if (!boundingBox.contiene(destino)) return;
-	desconectarPunto(indice);
-	puntos[indice] = destino;
-	conectarPunto(indice);
+bool Delaunay::moverPunto(int indice, glm::vec3 destino){
+	cg_assert(indice>=4 and indice<static_cast<int>(puntos.size()),"indice de punto no valido");
+	if (!boundingBox.contiene(destino)) return false;
+	version = ++ultima_version;
+	std::vector<int> estrella;
+	armarEstrella(indice,estrella);
+	// si desde el destino se siguen viendo todas las aristas opuestas al punto
+	// (el link de la estrella) los triangulos siguen siendo validos
+	bool en_el_nucleo = true;
+	for(int i_tri : estrella) { 
+		const Triangulo &t = triangulos[i_tri];
+		int k = t.indiceVertice(indice);
+		if (orientacion(puntos[t[(k+1)%3]],puntos[t[(k+2)%3]],destino)<=0) {
+			en_el_nucleo = false;
+			break;
+		}
+	}
+	if (en_el_nucleo) {
+		puntos[indice] = destino;
+		recuperarDelaunay(estrella);
+		grilla[celda(destino)] = estrella[0]; // queda cerca aunque haya flips
+		return true;
+	}
+	
+	// los segmentos que llegan al punto se pierden al desconectarlo, asi que
+	// se vuelven a agregar desde el destino
+	std::vector<int> unidos;
+	for(int i_tri : estrella) { 
+		const Triangulo &t = triangulos[i_tri];
+		int k = t.indiceVertice(indice);
+		if (t.restringida[(k+2)%3]) unidos.push_back(t[(k+1)%3]);
+	}
+	glm::vec3 origen = puntos[indice];
+	auto reconectar = [&](glm::vec3 p) {
+		armarEstrella(indice,estrella);
+		desconectarPunto(indice,estrella);
+		puntos[indice] = p;
+		actualizarGrilla(indice,conectarPunto(indice));
+	};
+	std::vector<std::pair<int,int>> antes;
+	if (not unidos.empty()) antes = getSegmentos();
+	reconectar(destino);
+	size_t n_ok = 0;
+	while (n_ok<unidos.size() and agregarSegmento(indice,unidos[n_ok]) and esSegmento(indice,unidos[n_ok])) 
+		++n_ok;
+	if (n_ok==unidos.size()) return true;
+	
+	// si alguno cruza otro segmento, o quedo partido por pasar por otro punto,
+	// se deshace el movimiento para que no cambie el conjunto de segmentos (la
+	// otra triangulacion del warping tiene que tener los mismos): se quitan los
+	// tramos nuevos que no llegan al punto (los que llegan se pierden al
+	// desconectarlo) y se vuelve a conectar en el origen, con los de antes
+	auto estaba = [&](const std::pair<int,int> &s) {
+		return std::find(antes.begin(),antes.end(),s)!=antes.end() or
+			std::find(antes.begin(),antes.end(),std::make_pair(s.second,s.first))!=antes.end();
+	};
+	for(const auto &s : getSegmentos())
+		if (not estaba(s)) eliminarSegmento(s.first,s.second);
+	reconectar(origen);
+	for(int otro : unidos) 
+		agregarSegmento(indice,otro);
+	return false;
 }
 
 // quita un punto de la triangulacion y repone Delaunay
 void Delaunay::eliminarPunto(int indice) {
-	cg_assert(indice>=0 and indice<puntos.size(),"indice de punto no valido");
-	desconectarPunto(indice);
-	// quitar de la lista el pto y los dos triangulos que ya no sirven
-	std::swap(puntos[indice],puntos.back());
-	puntos.pop_back();
-	int iback = puntos.size();
+	cg_assert(indice>=4 and indice<static_cast<int>(puntos.size()),"indice de punto no valido");
+	std::vector<int> estrella;
+	armarEstrella(indice,estrella);
+	desconectarPunto(indice,estrella);
+	// quitar de la lista el pto, pasando el ultimo a su lugar (solo hay que
+	// renombrarlo en los triangulos de su estrella)
+	int iback = puntos.size()-1;
 	if (iback!=indice) {
-		for(Triangulo &t : triangulos) {
-			for(int k=0;k<3;++k) { 
-				if (t[k]==iback) 
-					t[k] = indice;
+		armarEstrella(iback,estrella);
+		for(int i_tri : estrella) { 
+			Triangulo &t = triangulos[i_tri];
+			t[t.indiceVertice(iback)] = indice;
+		}
+		puntos[indice] = puntos[iback];
+	}
+	puntos.pop_back();
+}
+
+int Delaunay::trianguloDelPunto(int indice) const {
+	int i_tri = enQueTriangulo(puntos[indice],semilla(puntos[indice]));
+	// la caminata termina en un triangulo que tiene al punto en su borde, que
+	// casi siempre es uno de su estrella (salvo triangulos degenerados)
+	if (triangulos[i_tri].indiceVertice(indice)!=-1) return i_tri;
+	for(int k=0;k<3;++k) { 
+		int i_vec = triangulos[i_tri].vecinos[k];
+		if (i_vec!=-1 and triangulos[i_vec].indiceVertice(indice)!=-1) return i_vec;
+	}
+	for(i_tri=0;i_tri<static_cast<int>(triangulos.size());++i_tri)
+		if (triangulos[i_tri].indiceVertice(indice)!=-1) break;
+	cg_assert(i_tri<static_cast<int>(triangulos.size()),"el punto no esta en la triangulacion");
+	return i_tri;
+}
+
+// gira alrededor del punto pasando al vecino por la arista que sale del punto
+// hacia el vertice (k+2)%3; como los unicos puntos en el borde de la
+// triangulacion son las esquinas del bounding box, la estrella de cualquier
+// otro se cierra; la de una esquina llega al borde, y entonces se completa
+// girando para el otro lado desde el primero
+void Delaunay::armarEstrella(int indice, std::vector<int> &estrella) const {
+	estrella.clear();
+	int i_tri0 = trianguloDelPunto(indice), i_tri = i_tri0;
+	do {
+		estrella.push_back(i_tri);
+		const Triangulo &t = triangulos[i_tri];
+		i_tri = t.vecinos[(t.indiceVertice(indice)+1)%3];
+		cg_assert(estrella.size()<=triangulos.size(),"estrella no valida");
+	} while (i_tri!=i_tri0 and i_tri!=-1);
+	if (i_tri==-1) {
+		cg_assert(indice<4,"estrella abierta");
+		std::vector<int> antes;
+		i_tri = i_tri0;
+		while (true) {
+			const Triangulo &t = triangulos[i_tri];
+			i_tri = t.vecinos[(t.indiceVertice(indice)+2)%3];
+			if (i_tri==-1) break;
+			antes.push_back(i_tri);
+		}
+		estrella.insert(estrella.begin(),antes.rbegin(),antes.rend());
+	}
+}
+
+int Delaunay::buscarArista(int u, int v, int &k) const {
+	std::vector<int> estrella;
+	armarEstrella(u,estrella);
+	int i_otro = -1, k_otro = -1;
+	for(int i_tri : estrella) { 
+		const Triangulo &t = triangulos[i_tri];
+		int ku = t.indiceVertice(u);
+		if (t[(ku+1)%3]==v) { k = (ku+2)%3; return i_tri; }
+		if (t[(ku+2)%3]==v) { i_otro = i_tri; k_otro = (ku+1)%3; }
+	}
+	k = k_otro;
+	return i_otro;
+}
+
+bool Delaunay::marcarArista(int u, int v, bool restringida) {
+	int k, i_tri = buscarArista(u,v,k);
+	if (i_tri==-1) return false;
+	Triangulo &t = triangulos[i_tri];
+	t.restringida[k] = restringida;
+	if (t.vecinos[k]!=-1) {
+		Triangulo &tv = triangulos[t.vecinos[k]];
+		tv.restringida[tv.indiceVecino(i_tri)] = restringida;
+	}
+	return true;
+}
+
+bool Delaunay::esSegmento(int i0, int i1) const {
+	cg_assert(i0>=0 and i0<static_cast<int>(puntos.size()) and i1>=0 and i1<static_cast<int>(puntos.size()),"indice de punto no valido");
+	int k, i_tri = buscarArista(i0,i1,k);
+	return i_tri!=-1 and triangulos[i_tri].restringida[k];
+}
+
+std::vector<std::pair<int,int>> Delaunay::getSegmentos() const {
+	std::vector<std::pair<int,int>> segmentos;
+	for(int i_tri=0;i_tri<static_cast<int>(triangulos.size());++i_tri) { 
+		const Triangulo &t = triangulos[i_tri];
+		for(int k=0;k<3;++k) // cada uno lo agrega el triangulo de mayor indice
+			if (t.restringida[k] and t.vecinos[k]<i_tri)
+				segmentos.emplace_back(t[(k+1)%3],t[(k+2)%3]);
+	}
+	return segmentos;
+}
+
+// Sigue los segmentos alineados con i0-i1 que avanzan hacia i1 sin pasarse
+std::vector<std::pair<int,int>> Delaunay::tramosSegmento(int i0, int i1) const {
+	cg_assert(i0>=0 and i0<static_cast<int>(puntos.size()) and i1>=0 and i1<static_cast<int>(puntos.size()),"indice de punto no valido");
+	std::vector<std::pair<int,int>> tramos, segmentos = getSegmentos();
+	const glm::vec3 &a = puntos[i0], &b = puntos[i1];
+	for(int actual=i0; actual!=i1; ) {
+		int siguiente = -1;
+		for(const auto &s : segmentos) { 
+			int otro = s.first==actual ? s.second : (s.second==actual ? s.first : -1);
+			if (otro==-1 or orientacion(a,b,puntos[otro])!=0) continue;
+			if (glm::dot(puntos[otro]-puntos[actual],b-a)>0 and glm::dot(b-puntos[otro],b-a)>=0) {
+				siguiente = otro;
+				break;
 			}
 		}
+		if (siguiente==-1) return {};
+		tramos.emplace_back(actual,siguiente);
+		actual = siguiente;
 	}
+	return tramos;
 }
 
-void Delaunay::desconectarPunto(int indice_del) {
-	
-	// armar la lista de triangulos que contienen al punto
-	std::vector<int> lista, para_revisar;
-	for (int i_tri=0;i_tri<triangulos.size();i_tri++)
-		if (triangulos[i_tri].indiceVertice(indice_del)!=-1)
-			lista.push_back(i_tri);
+// En cada triangulo la recta ab entra por un vertice o una arista y sale por
+// la arista que tiene un extremo de cada lado (a la derecha el primero del par)
+// o por el vertice opuesto, si esta sobre la recta; desde es un vertice, asi
+// que el primer triangulo es el de su estrella que tiene la arista de salida
+// (o la arista hasta b, o hasta un vertice alineado hacia adelante)
+int Delaunay::cruzarAristas(int desde, int a, int b, std::vector<std::pair<int,int>> &cruzadas) const {
+	const glm::vec3 &pa = puntos[a], &pb = puntos[b], &pd = puntos[desde];
+	auto adelante = [&](int w) { // w alineado con ab y mas alla de desde
+		glm::vec3 dw = puntos[w]-pd, db = pb-pd;
+		return orientacion(pa,pb,puntos[w])==0 and dw.x*db.x+dw.y*db.y>0;
+	};
+	std::vector<int> estrella;
+	armarEstrella(desde,estrella);
+	int i_tri = -1, k = -1, u = -1, v = -1;
+	for(int i : estrella) { 
+		const Triangulo &t = triangulos[i];
+		int kd = t.indiceVertice(desde);
+		int tu = t[(kd+1)%3], tv = t[(kd+2)%3];
+		if (tu==b or tv==b) return b;
+		if (adelante(tu)) return tu;
+		if (adelante(tv)) return tv;
+		if (orientacion(pa,pb,puntos[tu])<0 and orientacion(pa,pb,puntos[tv])>0) {
+			i_tri = i; k = kd; u = tu; v = tv;
+			break;
+		}
+	}
+	cg_assert(i_tri!=-1,"no se encontro por donde sale el segmento");
+	while (true) {
+		const Triangulo &t = triangulos[i_tri];
+		if (t.restringida[k]) return -1;
+		cruzadas.emplace_back(u,v);
+		int i_vec = t.vecinos[k];
+		cg_assert(i_vec!=-1,"el segmento sale del bounding box");
+		const Triangulo &tv = triangulos[i_vec];
+		int w = tv[tv.indiceVecino(i_tri)];
+		if (w==b) return b;
+		double o = orientacion(pa,pb,puntos[w]);
+		if (o==0) return w;
+		if (o<0) { k = tv.indiceVertice(u); u = w; }
+		else     { k = tv.indiceVertice(v); v = w; }
+		i_tri = i_vec;
+	}
+}
+
+// Primero se recorre todo el segmento sin tocar nada (si cruza otro segmento
+// no se agrega), partiendolo en los vertices que estan sobre el. Despues, para
+// cada tramo, se intercambian las diagonales de las aristas que lo cruzan: si el
+// cuadrilatero de la arista es convexo se intercambia y la nueva diagonal, si
+// todavia cruza el tramo, vuelve a la cola; si no es convexo se deja para mas
+// adelante (Sloan: siempre hay alguna que se puede intercambiar, asi que
+// termina). Al final se repone Delaunay en los triangulos que cambiaron, sin
+// tocar las aristas marcadas
+bool Delaunay::agregarSegmento(int i0, int i1) {
+	cg_assert(i0>=0 and i0<static_cast<int>(puntos.size()) and i1>=0 and i1<static_cast<int>(puntos.size()),"indice de punto no valido");
+	if (i0==i1) return false;
+	std::vector<std::pair<int,int>> tramos;
+	std::vector<std::vector<std::pair<int,int>>> cruzadas;
+	for(int desde=i0; desde!=i1; ) {
+		cruzadas.emplace_back();
+		int hasta = cruzarAristas(desde,i0,i1,cruzadas.back());
+		if (hasta==-1) return false;
+		tramos.emplace_back(desde,hasta);
+		desde = hasta;
+	}
 	
-	// borrar triangulos hasta que queden tres
-	while (lista.size()>3) {
-		// recuperar un triangulo y buscar un vecino que comparta el punto
-		int i_tri1 = lista.back();
-		Triangulo &tri1 = triangulos[i_tri1];
-		int aux = tri1.indiceVertice(indice_del);
-		int i_tri2 = tri1.vecinos[(aux+1)%3];
-		Triangulo &tri2 = triangulos[i_tri2];
-		
-		// encontrar los puntos para las diagonales
-		int indice1 = tri1.indiceVecino(i_tri2);
-		int indice2 = tri2.indiceVecino(i_tri1);
-		// si se intersecan intercambiar diagonales y marcar para revisar
-		if (seIntersecan(tri1[(indice1+1)%3], tri1[(indice1+2)%3],
-						 tri1[indice1],       tri2[indice2]      )) 
-		{
-			intercambiarDiagonales(i_tri1,i_tri2);
-			// borrar de la lista el triangulito que ya no contiene al punto
-			if (tri1.indiceVertice(indice_del)!=-1) {
-				para_revisar.push_back(i_tri2);
-				lista.erase(find(lista.begin(),lista.end(),i_tri2));
-			} else {
-				para_revisar.push_back(i_tri1);
-				lista.pop_back();
+	version = ++ultima_version;
+	std::vector<int> para_revisar;
+	for(size_t i=0;i<tramos.size();++i) { 
+		int a = tramos[i].first, b = tramos[i].second;
+		std::deque<std::pair<int,int>> cola(cruzadas[i].begin(),cruzadas[i].end());
+		while (not cola.empty()) {
+			std::pair<int,int> e = cola.front(); cola.pop_front();
+			int k, i_tri = buscarArista(e.first,e.second,k);
+			cg_assert(i_tri!=-1,"se perdio una arista que cruza el segmento");
+			int i_vec = triangulos[i_tri].vecinos[k];
+			int w1 = triangulos[i_tri][k], w2 = triangulos[i_vec][triangulos[i_vec].indiceVecino(i_tri)];
+			if (not seIntersecan(e.first,e.second,w1,w2)) { // no convexo
+				cola.push_back(e);
+				continue;
 			}
-		} else {
-			// si no se intercambio la diagonal, intercambiar los triangulos para no hacer otra vez la misma comparacion
-			std::swap(lista.back(),*find(lista.begin(),lista.end(),i_tri2));
+			intercambiarDiagonales(i_tri,i_vec);
+			para_revisar.push_back(i_tri);
+			para_revisar.push_back(i_vec);
+			if (w1!=a and w1!=b and w2!=a and w2!=b and seIntersecan(w1,w2,a,b))
+				cola.emplace_back(w1,w2);
 		}
+		marcarArista(a,b,true);
 	}
+	recuperarDelaunay(para_revisar);
+	return true;
+}
+
+bool Delaunay::eliminarSegmento(int i0, int i1) {
+	cg_assert(i0>=0 and i0<static_cast<int>(puntos.size()) and i1>=0 and i1<static_cast<int>(puntos.size()),"indice de punto no valido");
+	int k, i_tri = buscarArista(i0,i1,k);
+	if (i_tri==-1 or not triangulos[i_tri].restringida[k]) return false;
+	version = ++ultima_version;
+	marcarArista(i0,i1,false);
+	std::vector<int> para_revisar = {i_tri};
+	if (triangulos[i_tri].vecinos[k]!=-1) para_revisar.push_back(triangulos[i_tri].vecinos[k]);
+	recuperarDelaunay(para_revisar);
+	return true;
+}
+
+// oreja del poligono que deja un punto al desconectarlo (ver desconectarPunto)
+struct Oreja {
+	double potencia; // del punto que se quita respecto de su circunferencia
+	int vertice, sello; // vertice del medio y version de ese vertice al calcularla
+	bool operator<(const Oreja &o) const { return potencia>o.potencia; } // la menor arriba
+};
+
+// Los vecinos del punto forman un poligono estrellado desde el punto, y la oreja
+// convexa cuya circunferencia deja al punto con la menor potencia es un triangulo
+// de Delaunay del poligono (Devillers), asi que se corta esa y se sigue con el
+// poligono que queda. Las orejas estan en una cola de prioridad y al cortar una
+// solo cambian las de sus dos vecinos, asi que cuesta O(d log d) con d el grado
+// del punto (antes se intercambiaban diagonales de la estrella hasta dejar tres
+// triangulos, lo que con puntos alineados podia no terminar). Los nuevos
+// triangulos ocupan los primeros lugares de la estrella y los dos que sobran se
+// borran pasando el ultimo del vector a su lugar
+int Delaunay::desconectarPunto(int indice_del, const std::vector<int> &estrella) {
+	version = ++ultima_version;
+	const glm::vec3 &p = puntos[indice_del];
+	int d = estrella.size();
+	cg_assert(d>=3,"punto con menos de tres triangulos");
 	
-	// estirar uno de los triangulos(triangulote) y borrar los otros dos (triangulitos 1 y 2)
-	int i_triangulote = lista[0], i_triangulito1=lista[1], i_triangulito2=lista[2];
-	Triangulo &triangulote = triangulos[i_triangulote];
-	Triangulo &triangulito1 = triangulos[i_triangulito1];
-	Triangulo &triangulito2 = triangulos[i_triangulito2];
-	
-	// obtener el punto clickeado en cada triangulo
-	int indice0 = triangulote.indiceVertice(indice_del);
-	int indice1 = triangulito1.indiceVertice(indice_del);
-	int indice2 = triangulito2.indiceVertice(indice_del);
-	
-	// modificar el punto del triangulote
-	triangulote[indice0] = triangulito1[triangulito1.indiceVecino(i_triangulote)];
+	// vertice i del poligono: el que sigue al punto en estrella[i]; la arista que
+	// va de i al siguiente es la opuesta al punto en estrella[i], del otro lado
+	// esta el triangulo externo[i] que lo tiene como vecino lado[i] (al cortar
+	// orejas las diagonales pasan a ser aristas del poligono)
+	std::vector<int> vert(d), externo(d), lado(d), ant(d), sig(d), sello(d,0);
+	std::vector<char> fija(d); // si la arista de i al siguiente es un segmento
+	for(int i=0;i<d;++i) { 
+		const Triangulo &t = triangulos[estrella[i]];
+		int k = t.indiceVertice(indice_del);
+		vert[i] = t[(k+1)%3];
+		fija[i] = t.restringida[k];
+		externo[i] = t.vecinos[k];
+		lado[i] = externo[i]==-1 ? -1 : triangulos[externo[i]].indiceVecino(estrella[i]);
+		ant[i] = (i+d-1)%d;
+		sig[i] = (i+1)%d;
+	}
 	
-	// arreglar los vecinos de triangulote
-	triangulote.vecinos[triangulote.indiceVecino(i_triangulito1)] = triangulito1.vecinos[indice1];
-	triangulote.vecinos[triangulote.indiceVecino(i_triangulito2)] = triangulito2.vecinos[indice2];
+	// calcula la oreja con vertice j (si es convexa) y la encola
+	std::priority_queue<Oreja> cola;
+	auto encolar = [&](int j) {
+		const glm::vec3 &a = puntos[vert[ant[j]]], &b = puntos[vert[j]], &c = puntos[vert[sig[j]]];
+		double o = orientacion(a,b,c);
+		if (o<=0) return;
+		cola.push({-incircle(a.x,a.y,b.x,b.y,c.x,c.y,p.x,p.y)/o,j,sello[j]});
+	};
+	// la oreja no puede tener otro vertice adentro ni en la diagonal (con la
+	// potencia exacta y sin tolerancia no pasa, esto cubre el resto)
+	auto vacia = [&](int j) {
+		const glm::vec3 &a = puntos[vert[ant[j]]], &b = puntos[vert[j]], &c = puntos[vert[sig[j]]];
+		for(int l=sig[sig[j]];l!=ant[j];l=sig[l]) { 
+			const glm::vec3 &w = puntos[vert[l]];
+			if (orientacion(a,b,w)>=0 and orientacion(b,c,w)>=0 and orientacion(c,a,w)>=0)
+				return false;
+		}
+		return true;
+	};
+	// pone a i_ext como vecino k de i_tri, y a i_tri como vecino l de i_ext
+	auto conectar = [this](int i_tri, int k, int i_ext, int l, bool restringida) {
+		triangulos[i_tri].vecinos[k] = i_ext;
+		triangulos[i_tri].restringida[k] = restringida;
+		if (i_ext!=-1) triangulos[i_ext].vecinos[l] = i_tri;
+	};
 	
-	// arreglar los vecinos de los vecinos triangulote
-	int i_vecino1 = triangulito1.vecinos[indice1];
-	if (i_vecino1!=-1) {
-		Triangulo &vecino1 = triangulos[i_vecino1];
-		vecino1.vecinos[vecino1.indiceVecino(i_triangulito1)] = i_triangulote;
-	}
-	int i_vecino2 = triangulito2.vecinos[indice2];
-	if (i_vecino2!=-1) {
-		Triangulo &vecino2 = triangulos[i_vecino2];
-		vecino2.vecinos[vecino2.indiceVecino(i_triangulito2)] = i_triangulote;
+	for(int i=0;i<d;++i) encolar(i);
+	int m = d, n = 0; // vertices que quedan en el poligono, triangulos nuevos
+	bool reencoladas = false;
+	while (m>3) {
+		int i = 0;
+		if (not cola.empty()) {
+			Oreja e = cola.top(); cola.pop();
+			i = e.vertice;
+			if (e.sello!=sello[i] or not vacia(i)) continue; // cambio o no sirve
+			reencoladas = false;
+		} else if (not reencoladas) {
+			// se descartaron todas las que quedaban (la triangulacion no era
+			// exactamente de Delaunay por la tolerancia), se prueban otra vez
+			reencoladas = true;
+			for(int j=0;j<d;++j) { 
+				if (sello[j]<0) continue;
+				++sello[j];
+				encolar(j);
+			}
+			continue;
+		} else {
+			// no hay ninguna convexa: lo que queda del poligono son puntos
+			// alineados (sobre el borde del bounding box, donde quedan triangulos
+			// de area nula), asi que se corta cualquiera
+			while (sello[i]<0) ++i;
+		}
+		int a = ant[i], c = sig[i], i_tri = estrella[n++];
+		triangulos[i_tri] = {{vert[a],vert[i],vert[c]}};
+		conectar(i_tri,0,externo[i],lado[i],fija[i]); // arista i-c
+		conectar(i_tri,2,externo[a],lado[a],fija[a]); // arista a-i
+		externo[a] = i_tri; lado[a] = 1; fija[a] = false; // la diagonal c-a queda como arista de a
+		sig[a] = c; ant[c] = a; --m;
+		sello[i] = -1; ++sello[a]; ++sello[c];
+		encolar(a); encolar(c);
 	}
+	// queda un triangulo
+	int i = 0;
+	while (sello[i]<0) ++i;
+	int a = ant[i], c = sig[i], i_tri = estrella[n++];
+	triangulos[i_tri] = {{vert[a],vert[i],vert[c]}};
+	conectar(i_tri,0,externo[i],lado[i],fija[i]);
+	conectar(i_tri,1,externo[c],lado[c],fija[c]);
+	conectar(i_tri,2,externo[a],lado[a],fija[a]);
 	
-	// mandar a revisar la triangulacion nueva
-	para_revisar.push_back(i_triangulote);
-	recuperarDelaunay(para_revisar);
-	
-	for(int i=0;i<2;++i) { 
-		int i_tri = i==(i_triangulito1<i_triangulito2)?i_triangulito1:i_triangulito2;
-		std::swap(triangulos[i_tri],triangulos.back());
-		triangulos.pop_back();
-		int itri_back = triangulos.size();
-		if (i_tri==itri_back) continue;
-		for(Triangulo &t : triangulos) {
-			for(int k=0;k<3;++k) {
-				if (t.vecinos[k]==itri_back) 
-					t.vecinos[k] = i_tri;
+	// borrar los dos que sobran (primero el de mayor indice, para que el otro no
+	// sea el ultimo que se mueve), corrigiendo los vecinos del que se mueve
+	std::vector<int> nuevos(estrella.begin(),estrella.begin()+n);
+	for(int i_del : {std::max(estrella[d-1],estrella[d-2]), std::min(estrella[d-1],estrella[d-2])}) {
+		int i_ultimo = triangulos.size()-1;
+		if (i_del!=i_ultimo) {
+			triangulos[i_del] = triangulos[i_ultimo];
+			for(int k=0;k<3;++k) { 
+				int i_vec = triangulos[i_del].vecinos[k];
+				if (i_vec!=-1) triangulos[i_vec].reemplazarVecino(i_ultimo,i_del);
 			}
+			for(int &i_nuevo : nuevos) 
+				if (i_nuevo==i_ultimo) i_nuevo = i_del;
 		}
-	}	
+		triangulos.pop_back();
+	}
+	
+	// la potencia se compara en punto flotante y la triangulacion puede tener
+	// tolerancia, asi que igual se revisan los nuevos
+	int i_cerca = nuevos[0];
+	recuperarDelaunay(nuevos);
+	grilla[celda(p)] = i_cerca;
+	return i_cerca;
 }
 
 Pesos Delaunay::calcularPesos(int i_triangulo, glm::vec3 p) const {
@@ -228,47 +659,96 @@ Pesos Delaunay::calcularPesos(int i_triangulo, glm::vec3 p) const {
 }
 
 int Delaunay::enQueTriangulo(glm::vec3 &punto) const {
-	/// @todo: analizar y documentar este mtodo
-	int i_tri = rand()%triangulos.size();
+	return enQueTriangulo(punto,semilla(punto));
+}
+
+int Delaunay::semilla(const glm::vec3 &p) const {
+	int i_tri = grilla[celda(p)];
+	return i_tri<static_cast<int>(triangulos.size()) ? i_tri : 0;
+}
+
+int Delaunay::celda(const glm::vec3 &p) const {
+	glm::vec3 tam = boundingBox.pmax-boundingBox.pmin;
+	int i = tam.x>0 ? int((p.x-boundingBox.pmin.x)/tam.x*grilla_n) : 0;
+	int j = tam.y>0 ? int((p.y-boundingBox.pmin.y)/tam.y*grilla_n) : 0;
+	i = std::max(0,std::min(grilla_n-1,i));
+	j = std::max(0,std::min(grilla_n-1,j));
+	return j*grilla_n+i;
+}
+
+void Delaunay::rehacerGrilla() {
+	grilla_n = std::max(1,int(std::sqrt(puntos.size()/2.f)));
+	grilla.resize(grilla_n*grilla_n);
+	// buscar el centro de cada celda recorriendo la grilla en zigzag, cada
+	// busqueda arranca de la semilla de la celda anterior que esta al lado
+	glm::vec3 tam = (boundingBox.pmax-boundingBox.pmin)/float(grilla_n);
+	int i_tri = 0;
+	for(int j=0;j<grilla_n;++j) {
+		for(int k=0;k<grilla_n;++k) {
+			int i = j%2 ? grilla_n-1-k : k;
+			glm::vec3 centro = boundingBox.pmin + glm::vec3{(i+.5f)*tam.x,(j+.5f)*tam.y,0.f};
+			grilla[j*grilla_n+i] = i_tri = enQueTriangulo(centro,i_tri);
+		}
+	}
+}
+
+// camina por los vecinos hacia el punto: en cada triangulo, si el punto queda
+// del lado de afuera de alguna arista (orientacion negativa respecto de la
+// arista opuesta al vertice k, que es lo mismo que un peso k negativo) se pasa
+// al vecino por la arista donde queda mas afuera; con la orientacion exacta un
+// punto sobre una arista da 0 de ambos lados y no se va y viene, pero igual no
+// se vuelve por la arista por la que se entro ni se sale por el borde (si el
+// punto esta fuera del bounding box el resultado es un triangulo del borde). En
+// una triangulacion de Delaunay la caminata siempre termina, pero con una
+// tolerancia grande puede quedar lejos de serlo y ciclar; si da mas pasos que
+// triangulos hay, se busca en todos
+int Delaunay::enQueTriangulo(const glm::vec3 &punto, int i_tri) const {
+	int i_anterior = -1, pasos = 0;
 	while (i_tri!=-1) {
-		Pesos ff = calcularPesos(i_tri,punto);
-		int imin;
-		if (ff[0] < ff[2]) {
-			if (ff[0] < ff[1]) imin=0;
-			else               imin=1;
-		} else {
-			if (ff[2] < ff[1]) imin=2;
-			else               imin=1;
+		if (++pasos>static_cast<int>(triangulos.size())) 
+			return buscarTriangulo(punto);
+		const Triangulo &t = triangulos[i_tri];
+		double orient[3];
+		int imin = -1;
+		for(int k=0;k<3;++k) {
+			orient[k] = orientacion(puntos[t[(k+1)%3]],puntos[t[(k+2)%3]],punto);
+			if (orient[k]<0 and t.vecinos[k]!=-1 and t.vecinos[k]!=i_anterior and (imin==-1 or orient[k]<orient[imin]))
+				imin = k;
 		}
-		if (ff[imin]>=0) break;
-		i_tri = triangulos[i_tri].vecinos[imin];
+		if (imin==-1) break;
+		i_anterior = i_tri;
+		i_tri = t.vecinos[imin];
 	}
 	return i_tri;
 }
 
+int Delaunay::buscarTriangulo(const glm::vec3 &punto) const {
+	int i_mejor = -1;
+	float peso_mejor = 0.f;
+	for(int i_tri=0;i_tri<static_cast<int>(triangulos.size());++i_tri) {
+		Pesos ff = calcularPesos(i_tri,punto);
+		float peso = std::min(ff[0],std::min(ff[1],ff[2]));
+		if (i_mejor==-1 or peso>peso_mejor) { i_mejor = i_tri; peso_mejor = peso; }
+		if (peso>=0) break;
+	}
+	return i_mejor;
+}
+
 // devuelve verdadero si el punto esta contenido (estrictamente) en la circunferencia formada por los tres vertices
 bool Delaunay::circunferenciaContiene(const Triangulo &t, glm::vec3 p) const {
 	
-	// traer el triangulo al origen (vertice0 en 0,0)
-	glm::vec3 punto1 = puntos[t[1]]-puntos[t[0]];
-	glm::vec3 punto2 = puntos[t[2]]-puntos[t[0]];
-	// desplazar igualmente el punto a averiguar si esta contenido
-	glm::vec3 puntoDesp = p-puntos[t[0]];
-	
-	// calcular el doble del area con el producto vectorial
-	float area4 = 2*(glm::cross(punto1,punto2).z);
-	if (area4==0) return false;
-	
-	float mod2Punto1 = glm::dot(punto1,punto1),
-		  mod2Punto2 = glm::dot(punto2,punto2);
+	const glm::vec3 &a = puntos[t[0]], &b = puntos[t[1]], &c = puntos[t[2]];
 	
-	// calcula el punto del centro (en la version desplazada)
-	glm::vec3 centro( (mod2Punto1*punto2.y-mod2Punto2*punto1.y)/area4,
-				      (punto1.x*mod2Punto2-punto2.x*mod2Punto1)/area4, 0.f );
+	// el doble del area (con signo exacto, un triangulo degenerado no tiene circunferencia)
+	double area2 = orientacion(a,b,c);
+	if (area2<=0) return false;
 	
-	// compara la distancia con el radio
-	glm::vec3 vdist = puntoDesp-centro;
-	return glm::dot(centro,centro) - glm::dot(vdist,vdist) > error_tol;
+	// determinante de incircle, que es area2*(radio^2-distancia_al_centro^2); asi
+	// se compara con el radio sin calcular el centro, que en triangulos finitos
+	// se divide por un area casi nula y pierde toda la precision; el signo es
+	// exacto, y la tolerancia (si hay) se aplica sobre su valor aproximado
+	double det = incircle(a.x,a.y,b.x,b.y,c.x,c.y,p.x,p.y);
+	return det>0 and det > error_tol*area2;
 }
 
 void Delaunay::recuperarDelaunay(std::vector<int> tris_a_revisar){
@@ -287,6 +767,7 @@ void Delaunay::recuperarDelaunay(std::vector<int> tris_a_revisar){
 			// obtener el vecino del triangulo a revisar
 			int i_vec = triangulos[i_tri].vecinos[k];
 			if (i_vec==-1) continue; // si no tiene vecino (triangulo del borde), no hacer nada
+			if (triangulos[i_tri].restringida[k]) continue; // los segmentos no se intercambian
 			
 			// si no cumple la condicion de Delaunay
 			if (circunferenciaContiene(triangulos[i_vec],puntos[triangulos[i_tri][k]])) {
@@ -303,21 +784,15 @@ void Delaunay::recuperarDelaunay(std::vector<int> tris_a_revisar){
 	}
 }
 
-bool Delaunay::seIntersecan(int ipunto11, int ipunto12, int ipunto21, int ipunto22) {
-	// definir lineas para intersecar
-	float x11 = puntos[ipunto11].x, y11 = puntos[ipunto11].y,
-	      x12 = puntos[ipunto12].x, y12 = puntos[ipunto12].y,
-	      x21 = puntos[ipunto21].x, y21 = puntos[ipunto21].y,
-	      x22 = puntos[ipunto22].x, y22 = puntos[ipunto22].y;
-	// ver si se intersecan
-	float a1 = x12-x11, b1 = x21-x22, c1 = x21-x11,
-		  a2 = y12-y11, b2 = y21-y22, c2 = y21-y11;
-	float w = a1*b2-a2*b1;
-	if (w==0.f) return false;
-	float t1 = (c1*b2-c2*b1)/w;
-	float t2 = (a1*c2-a2*c1)/w;
-	// se intersecan?
-	return (t1>0 && t1<1 && t2>0 && t2<1);
+bool Delaunay::seIntersecan(int ipunto11, int ipunto12, int ipunto21, int ipunto22) const {
+	const glm::vec3 &p11 = puntos[ipunto11], &p12 = puntos[ipunto12],
+	                &p21 = puntos[ipunto21], &p22 = puntos[ipunto22];
+	// se intersecan (en el interior de ambos) si los extremos de cada uno
+	// quedan estrictamente de distinto lado de la recta del otro
+	double o1 = orientacion(p11,p12,p21), o2 = orientacion(p11,p12,p22);
+	if (not ((o1>0 and o2<0) or (o1<0 and o2>0))) return false;
+	double o3 = orientacion(p21,p22,p11), o4 = orientacion(p21,p22,p12);
+	return (o3>0 and o4<0) or (o3<0 and o4>0);
 }
 //
 //bool Delaunay::estaEnElBoundingBox(glm::vec3 &punto){
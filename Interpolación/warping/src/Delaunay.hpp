@@ -3,12 +3,14 @@
 
 #include <algorithm>
 #include <glm/glm.hpp>
+#include <utility>
 #include <vector>
 #include "utils.hpp"
 
 struct Triangulo {
 	int vertices[3];
 	int vecinos[3] = {-1,-1,-1};
+	bool restringida[3] = {false,false,false}; // la arista opuesta al vertice k es un segmento fijo
 	int operator[](int i) const { return vertices[i]; }
 	int &operator[](int i) { return vertices[i]; }
 	int indiceVertice(int i) const {
@@ -38,35 +40,130 @@ public:
 	
 	// agrega un punto a la triangulacion y devuelve el indice
 	int agregarPunto(glm::vec3 punto);
+	
+	// agrega muchos puntos de una vez y devuelve sus indices (-1 para los que
+	// quedan fuera del bounding box); los inserta ordenados (BRIO: rondas al azar
+	// de tamanio creciente, cada una ordenada segun una curva de Hilbert) para
+	// que cada busqueda arranque desde el triangulo del punto anterior, que
+	// queda cerca, y el costo total sea casi O(N log N)
+	std::vector<int> agregarPuntos(const std::vector<glm::vec3> &nuevos);
 
-	// mueve un punto en la triangulacion y devuelve el indice
-	void moverPunto(int indice, glm::vec3 destino);
+	// mueve un punto en la triangulacion: si el destino queda dentro del nucleo
+	// de la estrella del punto (todos sus triangulos siguen con area positiva)
+	// no cambia la topologia y alcanza con intercambiar diagonales a partir de
+	// esos triangulos, que es O(grado) por cada paso de un arrastre; si no, lo
+	// desconecta y lo vuelve a conectar en el destino; devuelve false (y el punto
+	// queda donde estaba) si el destino esta fuera del bounding box o si desde ahi
+	// algun segmento que llega al punto cruzaria otro o pasaria por otro punto
+	bool moverPunto(int indice, glm::vec3 destino);
 	
 	const BoundingBox &getBoundingBox() const { return boundingBox; }
 	
-	// elimina un punto de la triangulacion
+	// identifica la topologia actual: cambia cada vez que se agrega, mueve o
+	// elimina un punto (las copias comparten la version mientras no cambien)
+	int getVersion() const { return version; }
+	
+	// elimina un punto de la triangulacion (y los segmentos que llegan a el)
 	void eliminarPunto(int indice);
 	
+	// fuerza a que el segmento entre dos puntos sea una arista (triangulacion de
+	// Delaunay restringida): se intercambian las diagonales de las aristas que lo
+	// cruzan hasta que aparece, y despues ya no se intercambia; si pasa por otros
+	// puntos queda partido en varios; devuelve false (y no cambia nada) si cruza
+	// otro segmento
+	bool agregarSegmento(int i0, int i1);
+	
+	// vuelve a dejar libre la arista entre dos puntos y repone Delaunay alrededor;
+	// devuelve false si no era un segmento
+	bool eliminarSegmento(int i0, int i1);
+	
+	// si la arista entre dos puntos es un segmento
+	bool esSegmento(int i0, int i1) const;
+	
+	// los segmentos en que quedo partido el segmento i0-i1 al agregarlo (por pasar
+	// por otros puntos), en orden de i0 a i1; solo {i0,i1} si no se partio, y
+	// vacio si no esta (o si los tramos ya no estan alineados)
+	std::vector<std::pair<int,int>> tramosSegmento(int i0, int i1) const;
+	
+	// todos los segmentos (pares de indices de puntos)
+	std::vector<std::pair<int,int>> getSegmentos() const;
+	
 	// funciones para obtener los datos de un punto, un triangulo, o las listas completas
 	const std::vector<glm::vec3> &getPuntos() const { return puntos; }
 	const std::vector<Triangulo> &getTriangulos() const { return triangulos; }
 	
-	// devuelve el indice del triangulo que contiene al punto
+	// devuelve el indice del triangulo que contiene al punto (la busqueda
+	// arranca desde la semilla de la celda de la grilla donde cae el punto)
 	int enQueTriangulo(glm::vec3 &p) const;
 	
+	// idem, pero empezando a caminar desde el triangulo i_inicio
+	int enQueTriangulo(const glm::vec3 &p, int i_inicio) const;
+	
 private:
 	
 	float error_tol;
+	int version;
+	static int ultima_version;
 	BoundingBox boundingBox;
 	std::vector<glm::vec3> puntos;
 	std::vector<Triangulo> triangulos;
 	
-	// desconecta un punto de la triangulacion pero sin sacar del vector de puntos
-	void desconectarPunto(int indice);
+	// grilla uniforme de grilla_n x grilla_n celdas sobre el bounding box, con un
+	// triangulo "semilla" cercano a cada celda desde donde arrancar las busquedas;
+	// se actualiza al conectar y desconectar puntos, y se rehace mas fina cuando
+	// hay demasiados puntos por celda
+	int grilla_n = 1;
+	std::vector<int> grilla = {0};
+	
+	// indice de la celda donde cae el punto (los de afuera van a la del borde)
+	int celda(const glm::vec3 &p) const;
+	
+	// triangulo semilla de la celda del punto (al borrar triangulos no se
+	// actualizan todas las semillas, asi que puede ser una que ya no existe)
+	int semilla(const glm::vec3 &p) const;
+	
+	// arma la grilla de nuevo, con unos 2 puntos por celda
+	void rehacerGrilla();
+	
+	// anota a i_tri como semilla de la celda del punto recien conectado, o rehace
+	// la grilla si ya hay demasiados puntos por celda
+	void actualizarGrilla(int indice, int i_tri);
+	
+	// busca un triangulo que tenga al punto como vertice (camina hacia el punto y,
+	// si ahi no esta, lo busca en todos)
+	int trianguloDelPunto(int indice) const;
+	
+	// los triangulos que tienen al punto como vertice, en orden antihorario (la
+	// de una esquina del bounding box es abierta y empieza en el borde)
+	void armarEstrella(int indice, std::vector<int> &estrella) const;
+	
+	// triangulo que tiene la arista u-v (en ese sentido si lo hay, si no en el
+	// otro) y en k el indice de su vertice opuesto; -1 si no es una arista
+	int buscarArista(int u, int v, int &k) const;
+	
+	// marca o desmarca la arista u-v como segmento en los dos triangulos que la
+	// comparten; devuelve false si no es una arista
+	bool marcarArista(int u, int v, bool restringida);
+	
+	// camina desde el vertice desde por la recta de a a b (desde esta en el
+	// segmento) y junta las aristas que cruza hasta llegar a b o a otro vertice
+	// alineado, que devuelve; -1 si cruza un segmento
+	int cruzarAristas(int desde, int a, int b, std::vector<std::pair<int,int>> &cruzadas) const;
+	
+	// desconecta un punto de la triangulacion pero sin sacar del vector de
+	// puntos, retriangulando el hueco que deja su estrella por orejas; devuelve
+	// un triangulo cercano a donde estaba
+	int desconectarPunto(int indice, const std::vector<int> &estrella);
 	
 	// conencta un punto del vector de puntos (que no deberia estar asociado a 
-	// ningun triangulo) a la triangulacion
-	int conectarPunto(int indice);
+	// ningun triangulo) a la triangulacion; si se da i_inicio la busqueda del
+	// triangulo arranca desde ahi; devuelve un triangulo cercano al punto (no
+	// actualiza la grilla, ver actualizarGrilla)
+	int conectarPunto(int indice, int i_inicio=-1);
+	
+	// busqueda lineal del triangulo que contiene al punto (o del que le queda
+	// mas cerca si no lo contiene ninguno), para cuando falla la caminata
+	int buscarTriangulo(const glm::vec3 &p) const;
 	
 	// wrapper para la func calcularPesos global 
 	Pesos calcularPesos(int i_triangulo, glm::vec3 p) const;
@@ -79,7 +176,7 @@ private:
 	void intercambiarDiagonales(int itri1, int itri2);
 	
 	// verifica si se intersecan los dos segmentos formados por estos cuatro puntos
-	bool seIntersecan(int ipunto11, int ipunto12, int ipunto21, int ipunto22) ;
+	bool seIntersecan(int ipunto11, int ipunto12, int ipunto21, int ipunto22) const;
 	
 	// verifica si la circunferencia de un triangulo contiene a un pto de otro
 	bool circunferenciaContiene(const Triangulo &t, glm::vec3 p) const;
@@ -19,7 +19,9 @@ Shader &DelaunayRenderer::getShader() {
 	return shader;
 }
 
-void DelaunayRenderer::draw(const std::vector<glm::vec3> &vpts, const std::vector<Triangulo> &vtris, int sel) {
+void DelaunayRenderer::draw(const std::vector<glm::vec3> &vpts, const std::vector<Triangulo> &vtris, 
+							const std::vector<std::pair<int,int>> &vsegs, int sel) 
+{
 	
 	glBindVertexArray(VAO);
 	glBindBuffer(GL_ARRAY_BUFFER, VBO);
@@ -40,6 +42,16 @@ void DelaunayRenderer::draw(const std::vector<glm::vec3> &vpts, const std::vecto
 	glDrawElements(GL_TRIANGLES,vidxs.size(),GL_UNSIGNED_INT,vidxs.data());
 	glPolygonMode(GL_FRONT_AND_BACK,GL_FILL);
 	
+	if (not vsegs.empty()) {
+		vidxs.clear(); 
+		for(auto &s : vsegs) {
+			vidxs.push_back(s.first);
+			vidxs.push_back(s.second);
+		}
+		shader.setUniform("color",color_segments);
+		glDrawElements(GL_LINES,vidxs.size(),GL_UNSIGNED_INT,vidxs.data());
+	}
+	
 	glPointSize(3);
 	shader.setUniform("color",color_points);
 	glDrawArrays(GL_POINTS, 0,vpts.size());
@@ -7,12 +7,14 @@ class DelaunayRenderer {
 public:
 	DelaunayRenderer();
 	~DelaunayRenderer();
-	void draw(const std::vector<glm::vec3> &vpts, const std::vector<Triangulo> &vtris, int sel);
+	void draw(const std::vector<glm::vec3> &vpts, const std::vector<Triangulo> &vtris, 
+			  const std::vector<std::pair<int,int>> &vsegs, int sel);
 	Shader &getShader();
 private:
 	Shader shader;
 	GLuint VAO=0, VBO=0;
 	glm::vec3 color_triangles = {0.5f, 0.5f, 0.5f};
+	glm::vec3 color_segments = {1.f, 0.8f, 0.f};
 	glm::vec3 color_points = {1.f, 1.f, 1.f};
 	glm::vec3 color_selection = {1.f, 0.f, 0.f};
 };
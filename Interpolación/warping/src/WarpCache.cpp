@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "WarpCache.hpp"
+
+// cantidad de caras y vertice k de la cara f (con o sin indices)
+static int cantCaras(const Geometry &g) {
+	return (g.triangles.empty() ? g.positions.size() : g.triangles.size())/3;
+}
+static int verticeDeCara(const Geometry &g, int f, int k) {
+	return g.triangles.empty() ? 3*f+k : g.triangles[3*f+k];
+}
+
+// arma listas compactas: para cada "origen" los "destinos" que lo referencian
+// (ini tiene n_origen+1 elementos, los de o van de dest[ini[o]] a dest[ini[o+1]-1])
+template<typename F>
+static void armarCSR(int n_origen, int n_dest, int k_por_dest, F origen,
+					 std::vector<int> &ini, std::vector<int> &dest)
+{
+	ini.assign(n_origen+1,0);
+	for(int d=0;d<n_dest;++d)
+		for(int k=0;k<k_por_dest;++k)
+			++ini[origen(d,k)+1];
+	for(int o=0;o<n_origen;++o) ini[o+1] += ini[o];
+	dest.resize(ini[n_origen]);
+	std::vector<int> pos(ini.begin(),ini.end()-1);
+	for(int d=0;d<n_dest;++d)
+		for(int k=0;k<k_por_dest;++k)
+			dest[pos[origen(d,k)]++] = d;
+}
+
+// normal de un vertice: promedio de las normales de sus caras (como generateNormals)
+static glm::vec3 normalDeVertice(const std::vector<glm::vec3> &pos, const Geometry &g,
+								 const int *caras, int n_caras)
+{
+	glm::vec3 n(0.f);
+	for(int i=0;i<n_caras;++i) {
+		int f = caras[i];
+		const glm::vec3 &p0 = pos[verticeDeCara(g,f,0)],
+			            &p1 = pos[verticeDeCara(g,f,1)],
+						&p2 = pos[verticeDeCara(g,f,2)];
+		n += glm::cross(p2-p1,p0-p1);
+	}
+	return glm::dot(n,n)!=0 ? glm::normalize(n) : n;
+}
+
+glm::vec3 WarpCache::distorsionar(int i, const glm::vec3 &p, const Delaunay &delaunay0,
+								  const Delaunay &delaunay1) const
+{
+	const Triangulo &t = delaunay0.getTriangulos()[triangulo[i]];
+	const auto &v_p1 = delaunay1.getPuntos();
+	const Pesos &w = pesos[i];
+	glm::vec3 q = w[0]*v_p1[t[0]] + w[1]*v_p1[t[1]] + w[2]*v_p1[t[2]];
+	q.z = p.z; // es una deformacion 2D
+	return q;
+}
+
+bool WarpCache::ubicar(const Delaunay &delaunay0, const Geometry &geometry) {
+	int nv = geometry.positions.size();
+	if (version_pesos==delaunay0.getVersion() and static_cast<int>(triangulo.size())==nv) 
+		return false;
+	const auto &v_p0 = delaunay0.getPuntos();
+	const auto &v_tr0 = delaunay0.getTriangulos();
+	triangulo.resize(nv); pesos.resize(nv);
+	#pragma omp parallel for
+	for(int i=0;i<nv;++i) {
+		glm::vec3 p = geometry.positions[i];
+		int it = delaunay0.enQueTriangulo(p);
+		const Triangulo &t = v_tr0[it];
+		triangulo[i] = it;
+		pesos[i] = calcularPesos(v_p0[t[0]],v_p0[t[1]],v_p0[t[2]],p);
+	}
+	version_pesos = delaunay0.getVersion();
+	return true;
+}
+
+void WarpCache::recalcularTodo(const Delaunay &delaunay0, const Delaunay &delaunay1,
+							   const Geometry &geometry, GeometryRenderer &renderer)
+{
+	const auto &v_p0 = delaunay0.getPuntos();
+	const auto &v_tr0 = delaunay0.getTriangulos();
+	int nv = geometry.positions.size(), nf = cantCaras(geometry);
+
+	// ubicar cada vertice en delaunay0 y calcular sus pesos
+	ubicar(delaunay0,geometry);
+
+	// que vertices dependen de cada punto, y que caras tocan a cada vertice
+	armarCSR(v_p0.size(),nv,3,[&](int i, int k){ return v_tr0[triangulo[i]][k]; },
+			 ini_punto,vertices_de_punto);
+	armarCSR(nv,nf,3,[&](int f, int k){ return verticeDeCara(geometry,f,k); },
+			 ini_vertice,caras_de_vertice);
+
+	// distorsionar todo y subir a la gpu
+	posiciones.resize(nv); normales.resize(nv);
+	#pragma omp parallel for
+	for(int i=0;i<nv;++i)
+		posiciones[i] = distorsionar(i,geometry.positions[i],delaunay0,delaunay1);
+	#pragma omp parallel for
+	for(int i=0;i<nv;++i)
+		normales[i] = normalDeVertice(posiciones,geometry,caras_de_vertice.data()+ini_vertice[i],
+									  ini_vertice[i+1]-ini_vertice[i]);
+	renderer.updatePositions(posiciones,false);
+	renderer.updateNormals(normales,false);
+
+	puntos1 = delaunay1.getPuntos();
+	version = delaunay0.getVersion();
+}
+
+void WarpCache::aplicar(const Delaunay &delaunay0, const Delaunay &delaunay1,
+						const Geometry &geometry, GeometryRenderer &renderer)
+{
+	const auto &v_p1 = delaunay1.getPuntos();
+	if (version!=delaunay0.getVersion() or triangulo.size()!=geometry.positions.size() or
+		puntos1.size()!=v_p1.size())
+	{
+		recalcularTodo(delaunay0,delaunay1,geometry,renderer);
+		return;
+	}
+
+	// vertices que dependen de los puntos de delaunay1 que se movieron
+	std::vector<char> marcado(geometry.positions.size(),0);
+	std::vector<int> vertices;
+	for(size_t j=0;j<v_p1.size();++j) {
+		if (v_p1[j]==puntos1[j]) continue;
+		puntos1[j] = v_p1[j];
+		for(int k=ini_punto[j];k<ini_punto[j+1];++k) {
+			int i = vertices_de_punto[k];
+			if (not marcado[i]) { marcado[i] = 1; vertices.push_back(i); }
+		}
+	}
+	if (vertices.empty()) return;
+	int nvert = vertices.size();
+	#pragma omp parallel for
+	for(int j=0;j<nvert;++j) {
+		int i = vertices[j];
+		posiciones[i] = distorsionar(i,geometry.positions[i],delaunay0,delaunay1);
+	}
+
+	// las normales cambian en todos los vertices de las caras que tocan a esos
+	for(int j=0;j<nvert;++j) {
+		int i = vertices[j];
+		for(int k=ini_vertice[i];k<ini_vertice[i+1];++k) {
+			int f = caras_de_vertice[k];
+			for(int l=0;l<3;++l) {
+				int iv = verticeDeCara(geometry,f,l);
+				if (not marcado[iv]) { marcado[iv] = 1; vertices.push_back(iv); }
+			}
+		}
+	}
+	nvert = vertices.size();
+	#pragma omp parallel for
+	for(int j=0;j<nvert;++j) {
+		int i = vertices[j];
+		normales[i] = normalDeVertice(posiciones,geometry,caras_de_vertice.data()+ini_vertice[i],
+									  ini_vertice[i+1]-ini_vertice[i]);
+	}
+
+	// subir solo el rango de vertices que cambio
+	auto rango = std::minmax_element(vertices.begin(),vertices.end());
+	int desde = *rango.first, cant = *rango.second-desde+1;
+	glBindBuffer(GL_ARRAY_BUFFER,renderer.positionsVBO());
+	glBufferSubData(GL_ARRAY_BUFFER,desde*sizeof(glm::vec3),cant*sizeof(glm::vec3),posiciones.data()+desde);
+	glBindBuffer(GL_ARRAY_BUFFER,renderer.normalsVBO());
+	glBufferSubData(GL_ARRAY_BUFFER,desde*sizeof(glm::vec3),cant*sizeof(glm::vec3),normales.data()+desde);
+	glBindBuffer(GL_ARRAY_BUFFER,0);
+}
+
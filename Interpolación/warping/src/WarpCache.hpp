@@ -0,0 +1,53 @@
+#ifndef WARPCACHE_HPP
+#define WARPCACHE_HPP
+
+#include <vector>
+#include "Geometry.hpp"
+#include "Delaunay.hpp"
+
+// Distorsion de una geometria con pesos precalculados: para cada vertice se
+// guarda en que triangulo de delaunay0 cae y sus coordenadas baricentricas, y
+// eso solo se recalcula si cambia delaunay0 (su version). Si solo se mueven
+// puntos de delaunay1, se recalculan las posiciones de los vertices que caen en
+// triangulos que usan esos puntos, las normales de las caras que los tocan, y
+// se sube a la gpu solo el rango de vertices modificado.
+class WarpCache {
+public:
+	// aplica la distorsion y actualiza los buffers (si no cambio nada no hace nada)
+	void aplicar(const Delaunay &delaunay0, const Delaunay &delaunay1,
+				 const Geometry &geometry, GeometryRenderer &renderer);
+
+	// si los buffers tienen la geometria distorsionada
+	bool esValido() const { return version!=-1; }
+
+	// olvida lo calculado (por ej. porque se restauro la geometria original)
+	void invalidar() { version = -1; }
+
+	// ubica cada vertice en delaunay0 y calcula sus pesos, si no estaban ya
+	// calculados para esta version de delaunay0 (retorna true si los recalculo)
+	bool ubicar(const Delaunay &delaunay0, const Geometry &geometry);
+
+	// triangulo de delaunay0 y pesos de cada vertice (validos luego de ubicar o aplicar)
+	const std::vector<int> &getTriangulos() const { return triangulo; }
+	const std::vector<Pesos> &getPesos() const { return pesos; }
+
+private:
+	int version = -1; // version de delaunay0 con la que se actualizaron los buffers
+	int version_pesos = -1; // version de delaunay0 con la que se calcularon los pesos
+	std::vector<int> triangulo;  // triangulo de delaunay0 de cada vertice
+	std::vector<Pesos> pesos;    // coordenadas baricentricas de cada vertice
+	std::vector<glm::vec3> puntos1; // puntos de delaunay1 con los que se calculo
+	// listas compactas (CSR): vertices que dependen de cada punto de delaunay0,
+	// y caras que tocan a cada vertice
+	std::vector<int> ini_punto, vertices_de_punto;
+	std::vector<int> ini_vertice, caras_de_vertice;
+	std::vector<glm::vec3> posiciones, normales; // geometria distorsionada
+
+	void recalcularTodo(const Delaunay &delaunay0, const Delaunay &delaunay1,
+						const Geometry &geometry, GeometryRenderer &renderer);
+	glm::vec3 distorsionar(int i, const glm::vec3 &p, const Delaunay &delaunay0,
+						   const Delaunay &delaunay1) const;
+};
+
+#endif
+
@@ -0,0 +1,101 @@
+#include "WarpGPU.hpp"
+#include "Debug.hpp"
+
+// puntos de la triangulacion como (x,y), para un texture buffer RG32F
+static std::vector<glm::vec2> puntos2D(const Delaunay &d) {
+	std::vector<glm::vec2> v; v.reserve(d.getPuntos().size());
+	for(const glm::vec3 &p : d.getPuntos()) v.push_back({p.x,p.y});
+	return v;
+}
+
+template<typename T>
+static void cargarTextureBuffer(GLuint tbo, GLuint tex, GLenum formato, const std::vector<T> &v) {
+	glBindBuffer(GL_TEXTURE_BUFFER, tbo);
+	glBufferData(GL_TEXTURE_BUFFER, v.size()*sizeof(T), v.data(), GL_DYNAMIC_DRAW);
+	glBindTexture(GL_TEXTURE_BUFFER, tex);
+	glTexBuffer(GL_TEXTURE_BUFFER, formato, tbo);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void WarpGPU::actualizar(const Delaunay &delaunay0, const Delaunay &delaunay1, const Geometry &geometry) {
+	if (VBO[0]==0) {
+		glGenBuffers(2,VBO);
+		glGenBuffers(3,TBO);
+		glGenTextures(3,TEX);
+	}
+	
+	// si cambio delaunay0 (o es otra geometria): ubicar los vertices y
+	// cargar sus atributos, y los triangulos y puntos de delaunay0
+	if (cache.ubicar(delaunay0,geometry) or version!=delaunay0.getVersion()) {
+		const std::vector<int> &tris = cache.getTriangulos();
+		const std::vector<Pesos> &pesos = cache.getPesos();
+		glBindBuffer(GL_ARRAY_BUFFER,VBO[0]);
+		glBufferData(GL_ARRAY_BUFFER,tris.size()*sizeof(int),tris.data(),GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER,VBO[1]);
+		glBufferData(GL_ARRAY_BUFFER,pesos.size()*sizeof(Pesos),pesos.data(),GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER,0);
+		
+		std::vector<int> indices; indices.reserve(3*delaunay0.getTriangulos().size());
+		for(const Triangulo &t : delaunay0.getTriangulos())
+			indices.insert(indices.end(),t.vertices,t.vertices+3);
+		cargarTextureBuffer(TBO[0],TEX[0],GL_R32I,indices);
+		cargarTextureBuffer(TBO[1],TEX[1],GL_RG32F,puntos2D(delaunay0));
+		version = delaunay0.getVersion();
+	}
+	
+	// puntos de delaunay1: es lo unico que cambia al mover un punto
+	std::vector<glm::vec2> nuevos = puntos2D(delaunay1);
+	if (nuevos.size()!=puntos1.size()) {
+		cargarTextureBuffer(TBO[2],TEX[2],GL_RG32F,nuevos);
+	} else if (nuevos!=puntos1) {
+		glBindBuffer(GL_TEXTURE_BUFFER, TBO[2]);
+		glBufferSubData(GL_TEXTURE_BUFFER, 0, nuevos.size()*sizeof(glm::vec2), nuevos.data());
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	}
+	puntos1.swap(nuevos);
+}
+
+void WarpGPU::setBuffers(Shader &shader) const {
+	cg_assert(VBO[0]!=0,"WarpGPU::setBuffers antes de actualizar");
+	// el indice de triangulo es entero, asi que va con glVertexAttribIPointer
+	GLuint program = shader.getProgramId();
+	GLint loc_tri = glGetAttribLocation(program,"vertexTriangle");
+	cg_assert(loc_tri!=-1,"Shader does not have vertexTriangle attribute");
+	glBindBuffer(GL_ARRAY_BUFFER,VBO[0]);
+	glVertexAttribIPointer(loc_tri, 1, GL_INT, 0, 0);
+	glEnableVertexAttribArray(loc_tri);
+	shader.setBuffer("vertexWeights",VBO[1],GL_FLOAT,3);
+	
+	static const char *nombres[3] = { "triangles0", "points0", "points1" };
+	for(int i=0;i<3;++i) {
+		glActiveTexture(GL_TEXTURE0+i);
+		glBindTexture(GL_TEXTURE_BUFFER, TEX[i]);
+		shader.setUniform(nombres[i],i);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void WarpGPU::freeResources() {
+	if (VBO[0]==0) return;
+	glDeleteTextures(3,TEX);
+	glDeleteBuffers(3,TBO);
+	glDeleteBuffers(2,VBO);
+}
+
+WarpGPU::~WarpGPU() {
+	freeResources();
+}
+
+WarpGPU::WarpGPU(WarpGPU &&o) {
+	*this = static_cast<const WarpGPU&>(o);
+	o = static_cast<const WarpGPU&>(WarpGPU());
+}
+
+WarpGPU &WarpGPU::operator=(WarpGPU &&o) {
+	freeResources();
+	*this = static_cast<const WarpGPU&>(o);
+	o = static_cast<const WarpGPU&>(WarpGPU());
+	return *this;
+}
+
@@ -0,0 +1,42 @@
+#ifndef WARPGPU_HPP
+#define WARPGPU_HPP
+
+#include <vector>
+#include <glad/glad.h>
+#include "Shaders.hpp"
+#include "WarpCache.hpp"
+
+// Distorsion calculada en el vertex shader (shaders/warp.vert): cada vertice
+// lleva como atributos el triangulo de delaunay0 en el que cae y sus pesos, y
+// los triangulos y puntos de ambas triangulaciones van en texture buffers. Los
+// buffers de la geometria quedan con las posiciones originales; mover un punto
+// de delaunay1 solo actualiza su texture buffer (unos pocos bytes), y solo si
+// cambia delaunay0 se vuelven a ubicar los vertices.
+class WarpGPU {
+public:
+	WarpGPU() = default;
+	WarpGPU(WarpGPU &&o);
+	WarpGPU &operator=(WarpGPU &&o);
+	
+	// actualiza los atributos y texture buffers con lo que haya cambiado
+	void actualizar(const Delaunay &delaunay0, const Delaunay &delaunay1, const Geometry &geometry);
+	
+	// asocia los atributos al VAO de la geometria (llamar despues de
+	// shader.setBuffers) y los texture buffers a los uniforms del shader
+	void setBuffers(Shader &shader) const;
+	
+	~WarpGPU();
+private:
+	WarpGPU(const WarpGPU &) = delete;
+	WarpGPU &operator=(const WarpGPU &) = default;
+	void freeResources();
+	
+	WarpCache cache; // para ubicar los vertices
+	int version = -1; // version de delaunay0 con la que se cargaron los buffers
+	std::vector<glm::vec2> puntos1; // puntos de delaunay1 cargados
+	// VBO = { triangulo, pesos }, TBO/TEX = { triangulos0, puntos0, puntos1 }
+	GLuint VBO[2] = {0,0}, TBO[3] = {0,0,0}, TEX[3] = {0,0,0};
+};
+
+#endif
+
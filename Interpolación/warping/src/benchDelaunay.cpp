@@ -0,0 +1,74 @@
+// Benchmark de construccion de la triangulacion: compara agregar los puntos de
+// a uno (agregarPunto) contra agregarlos todos juntos (agregarPuntos), para
+// 10k a 1M puntos al azar; y mide la busqueda de 1M puntos (enQueTriangulo),
+// mover puntos de a pasos chicos y eliminar puntos. Como los tests, corre
+// antes del main, pero solo si se compila con BENCH_DELAUNAY definida (por ej.
+// -DBENCH_DELAUNAY en el proyecto); al terminar sale sin abrir la ventana.
+#ifdef BENCH_DELAUNAY
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "Delaunay.hpp"
+
+struct BenchDelaunay {
+	using reloj = std::chrono::steady_clock;
+	static double segundos(reloj::time_point t0) {
+		return std::chrono::duration<double>(reloj::now()-t0).count();
+	}
+	BenchDelaunay() {
+		// sin tolerancia: con la de la aplicacion (0.1) una nube tan densa casi
+		// no hace flips y queda una triangulacion que no es de Delaunay
+		float l = 1.f, tol = 0.f;
+		std::minstd_rand rng(42);
+		std::uniform_real_distribution<float> dist(-l,l);
+		for(int n : {10000, 100000, 1000000}) {
+			std::vector<glm::vec3> pts(n);
+			for(glm::vec3 &p : pts) p = {dist(rng),dist(rng),0.f};
+			
+			// de a uno (solo hasta 100k, mas es demasiado lento)
+			if (n<=100000) {
+				Delaunay d({-l,-l,-l},{+l,+l,+l},tol);
+				auto t0 = reloj::now();
+				for(glm::vec3 p : pts) d.agregarPunto(p);
+				std::cout << "agregarPunto  " << n << " puntos: " << segundos(t0) << "s" << std::endl;
+			}
+			
+			// todos juntos
+			Delaunay d({-l,-l,-l},{+l,+l,+l},tol);
+			auto t0 = reloj::now();
+			d.agregarPuntos(pts);
+			std::cout << "agregarPuntos " << n << " puntos: " << segundos(t0) << "s ("
+				      << d.getTriangulos().size() << " triangulos)" << std::endl;
+			
+			// ubicar muchos puntos (como hace warpPoint con cada vertice del modelo)
+			std::vector<glm::vec3> consultas(1000000);
+			for(glm::vec3 &p : consultas) p = {dist(rng),dist(rng),0.f};
+			t0 = reloj::now();
+			volatile int i_tri; // para que el compilador no saltee las busquedas
+			for(glm::vec3 &p : consultas) i_tri = d.enQueTriangulo(p);
+			std::cout << "enQueTriangulo " << consultas.size() << " consultas: " 
+				      << segundos(t0) << "s" << std::endl;
+			
+			// arrastrar puntos de a pasos chicos (como con el mouse, casi todos
+			// quedan en el nucleo de su estrella) y despues eliminar algunos
+			float paso = 0.1f*l/std::sqrt(float(n));
+			t0 = reloj::now();
+			for(int k=0;k<100000;++k) { 
+				int i = 4+rng()%(d.getPuntos().size()-4);
+				d.moverPunto(i,d.getPuntos()[i]+glm::vec3{paso*dist(rng),paso*dist(rng),0.f});
+			}
+			std::cout << "moverPunto 100000 pasos: " << segundos(t0) << "s" << std::endl;
+			t0 = reloj::now();
+			for(int k=0;k<10000;++k) d.eliminarPunto(4+rng()%(d.getPuntos().size()-4));
+			std::cout << "eliminarPunto 10000 puntos: " << segundos(t0) << "s" << std::endl;
+		}
+		std::exit(0);
+	}
+};
+
+BenchDelaunay bench_delaunay;
+
+#endif
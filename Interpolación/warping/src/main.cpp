@@ -15,13 +15,15 @@
 #include "BezierRenderer.hpp"
 #include "Delaunay.hpp"
 #include "DelaunayRenderer.hpp"
+#include "WarpCache.hpp"
+#include "WarpGPU.hpp"
 
 #define VERSION 20230913
 
 // settings
 std::vector<std::string> models_names = { "suzanne", "fish" };
 int current_model = 0;
-bool wireframe = false, apply_warp = true, 
+bool wireframe = false, apply_warp = true, gpu_warp = false,
 	 show_delaunay = false, show_points = true, move_camera=false;
 
 // triangulations
@@ -31,21 +33,23 @@ Delaunay delaunay0 = new_delaunay(), // triangulacion sobre la geometria origina
 Delaunay &current_delaunay() { return apply_warp?delaunay1:delaunay0; }
 Delaunay &other_delaunay()   { return apply_warp?delaunay0:delaunay1; }
 int selected_pt = -1;
+int segment_pt = -1; // primer extremo del segmento a agregar o quitar (shift+click)
 
 // callbacks
 void mouseMoveCallback(GLFWwindow* window, double xpos, double ypos);
 void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
 void keyboardCallback(GLFWwindow* glfw_win, int key, int scancode, int action, int mods);
 
-// funciones para aplicar o deshacer la distorsin
+// funciones para aplicar o deshacer la distorsin (para aplicarla a toda la
+// geometra se usa un WarpCache por parte del modelo)
 glm::vec3 warpPoint(const Delaunay &delaunay0, const Delaunay &delaunay1, glm::vec3 p);
-void applyWarp(const Delaunay &delaunay0, const Delaunay &delaunay1, 
-			   const Geometry &geometry, GeometryRenderer &renderer);
 void restoreGeometry(const Delaunay &delaunay0, const Delaunay &delaunay1, 
 			         const Geometry &geometry, GeometryRenderer &renderer);
 
 // funciones auxiliares
 void resetCamera();
+void resetAll();
+void toggleSegment(int i0, int i1);
 
 // programa principal
 int main() {
@@ -66,9 +70,13 @@ int main() {
 	// model and triangulation
 	Shader shader_phong("shaders/phong"),
 		   shader_wire("shaders/wireframe"),
+		   shader_phong_gpu("shaders/warp.vert","shaders/phong.frag"),
+		   shader_wire_gpu("shaders/warp.vert","shaders/wireframe.frag"),
 		   shader_plane("shaders/plane");
 	int loaded_model = -1;
 	std::vector<Model> models;
+	std::vector<WarpCache> warp_caches;
+	std::vector<WarpGPU> warp_gpus;
 	Model plane_z0 = Model::loadSingle("models/plane",Model::fDontFit);
 	DelaunayRenderer delaunay_renderer;
 	
@@ -81,19 +89,31 @@ int main() {
 		if (loaded_model!=current_model) {
 			models = Model::load("models/" + models_names[current_model], Model::fKeepGeometry|Model::fDynamic|Model::fNoTextures);
 			loaded_model = current_model;
+			warp_caches.assign(models.size(),WarpCache());
+			warp_gpus.clear(); warp_gpus.resize(models.size());
 		}
 		
 		// dibujar el modelo
 		glPolygonMode(GL_FRONT_AND_BACK,wireframe?GL_LINE:GL_FILL);
-		for(Model &part : models) {
-			Shader &shader = wireframe ? shader_wire : shader_phong;
+		for(size_t i=0;i<models.size();++i) {
+			Model &part = models[i];
+			bool en_gpu = apply_warp and gpu_warp;
+			Shader &shader = en_gpu ? (wireframe ? shader_wire_gpu : shader_phong_gpu)
+				                    : (wireframe ? shader_wire : shader_phong);
 			shader.use();
 			setMatrixes(shader);
 			shader.setLight(glm::vec4{-2.f,-2.f,-4.f,0.f}, glm::vec3{1.f,1.f,1.f}, 0.15f);
-			// aplicar deformacion
-			auto func = apply_warp?applyWarp:restoreGeometry;
-			func(delaunay0,delaunay1,part.geometry,part.buffers);
+			// aplicar deformacion (solo recalcula y sube lo que cambio); en la
+			// gpu los buffers tienen que tener la geometria original
+			if (apply_warp and not gpu_warp) {
+				warp_caches[i].aplicar(delaunay0,delaunay1,part.geometry,part.buffers);
+			} else if (warp_caches[i].esValido()) {
+				restoreGeometry(delaunay0,delaunay1,part.geometry,part.buffers);
+				warp_caches[i].invalidar();
+			}
+			if (en_gpu) warp_gpus[i].actualizar(delaunay0,delaunay1,part.geometry);
 			shader.setBuffers(part.buffers);
+			if (en_gpu) warp_gpus[i].setBuffers(shader);
 			shader.setMaterial(part.material);
 			part.buffers.draw();
 		}
@@ -104,7 +124,8 @@ int main() {
 			setMatrixes(delaunay_renderer.getShader());
 			delaunay_renderer.draw(current_delaunay().getPuntos(),
 								   show_delaunay ? delaunay0.getTriangulos() : std::vector<Triangulo>{},
-								   selected_pt);
+								   delaunay0.getSegmentos(),
+								   selected_pt!=-1 ? selected_pt : segment_pt);
 			glEnable(GL_DEPTH_TEST);
 		}
 		
@@ -120,6 +141,7 @@ int main() {
 		window.ImGuiDialog("CG Example",[&](){
 			ImGui::Combo(".obj (O)", &current_model,models_names);		
 			ImGui::Checkbox("Apply Warp (A)",&apply_warp);
+			ImGui::Checkbox("Warp on GPU (G)",&gpu_warp);
 			ImGui::Checkbox("Delaunay (D)",&show_delaunay);
 			ImGui::Checkbox("Wireframe (W)",&wireframe);
 			ImGui::Checkbox("Control Points(P)",&show_points);
@@ -127,8 +149,7 @@ int main() {
 			if (ImGui::Button("Reset Camera(E)")) resetCamera();
 			if (ImGui::Button("Reset Positions (R)"))
 				delaunay1 = delaunay0;
-			if (ImGui::Button("Reset All (C)")) 
-				delaunay1 = delaunay0 = new_delaunay();
+			if (ImGui::Button("Reset All (C)")) resetAll();
 			ImGui::Separator();
 			if (selected_pt==-1) {
 				ImGui::Text("Pto sel: -1");
@@ -136,6 +157,7 @@ int main() {
 				auto p = current_delaunay().getPuntos()[selected_pt];
 				ImGui::Text("Pto sel: %i (x=%f, y=%f)",selected_pt,p.x,p.y);
 			}
+			ImGui::TextDisabled("Shift+click en dos ptos: agregar/quitar segmento");
 		});
 		
 		// finish frame
@@ -184,23 +206,6 @@ glm::vec3 warpPoint(const Delaunay &delaunay0, const Delaunay &delaunay1, glm::v
 	return p; // Retorno la posicin nueva de p.
 }
 
-// distorsiona toda la geometra
-void applyWarp(const Delaunay &delaunay0, const Delaunay &delaunay1,
-			   const Geometry &geometry, GeometryRenderer &renderer) 
-{
-	// obtener vertices deformados
-	Geometry new_geom;
-	new_geom.positions.reserve(geometry.positions.size());
-	for(glm::vec3 p : geometry.positions)
-		new_geom.positions.push_back( warpPoint(delaunay0,delaunay1,p) );
-	
-	// recalcular normales y enviar los nuevos datos a la gpu
-	new_geom.triangles = geometry.triangles;
-	new_geom.generateNormals();
-	renderer.updatePositions(new_geom.positions,false);
-	renderer.updateNormals(new_geom.normals,false);
-}
-
 // restablece los vertices originales
 void restoreGeometry(const Delaunay &delaunay0, const Delaunay &delaunay1,
 					 const Geometry &geometry, GeometryRenderer &renderer) 
@@ -215,13 +220,14 @@ void keyboardCallback(GLFWwindow* glfw_win, int key, int scancode, int action, i
 	if (action!=GLFW_PRESS) return;
 	switch (key) {
 		case 'A': apply_warp = !apply_warp; break;
+		case 'G': gpu_warp = !gpu_warp; break;
 		case 'D': show_delaunay = !show_delaunay; break;
 		case 'P': show_points = !show_points; break;
 		case 'M': move_camera = !move_camera; break;
 		case 'E': resetCamera(); break;
 		case 'W': wireframe = !wireframe; break;
 		case 'R': delaunay1 = delaunay0; break;
-		case 'C': delaunay1 = delaunay0 = new_delaunay(); break;
+		case 'C': resetAll(); break;
 		case 'O': current_model = (current_model+1)%models_names.size(); break;
 	}
 }
@@ -268,11 +274,12 @@ void mouseMoveCallback(GLFWwindow* window, double xpos, double ypos) {
 		if (selected_pt<4) return; // no mover los del bbox
 		glm::vec3 p = viewportToPlane(xpos,ypos);
 		if (closestPoint(p,selected_pt)!=-1) return; // no acercar demasiado a otro
-		current_delaunay().moverPunto(selected_pt,p);
+		current_delaunay().moverPunto(selected_pt,p); // no se mueve si un segmento cruzaria otro
 	}
 }
 
 // click izquierdo: agregar o mover vertice de la triangulacin
+// shift + click izquierdo en dos vertices: agregar o quitar el segmento que los une
 // click derecho: eliminar vertice de la triangulacion
 void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
 	if (ImGui::GetIO().WantCaptureMouse) return;
@@ -289,7 +296,12 @@ void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
 			if (selected_pt<4) return; // no eliminar vertices del bounding box
 			delaunay1.eliminarPunto(selected_pt);
 			delaunay0.eliminarPunto(selected_pt);
-			selected_pt = -1;
+			selected_pt = segment_pt = -1; // los indices cambian
+		} else if (mods&GLFW_MOD_SHIFT) { // shift+click: extremo de un segmento
+			if (selected_pt==-1) return;
+			if (segment_pt==-1 or segment_pt==selected_pt) segment_pt = selected_pt;
+			else { toggleSegment(segment_pt,selected_pt); segment_pt = -1; }
+			selected_pt = -1; // no arrastrar
 		} else { // click izquierdo: agregar o mover punto
 			if (selected_pt!=-1) return; // seleccionado para mover, no hacer nada mas en este evento
 			if (not current_delaunay().getBoundingBox().contiene(p)) return; // no agregar fuera del bb
@@ -302,6 +314,45 @@ void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
 	}
 }
 
+void resetAll() {
+	delaunay1 = delaunay0 = new_delaunay();
+	selected_pt = segment_pt = -1;
+}
+
+// agrega (o quita, si ya estaba) el segmento en las dos triangulaciones; si al
+// agregarlo quedo partido en varios (por pasar por otros puntos) se quitan todos
+// sus tramos. Se agrega en las dos o en ninguna, y partido igual en las dos: si
+// cruza otro en alguna, o en una pasa por un punto que en la otra no esta
+// alineado, se deshace quitando los tramos nuevos de cada una
+void toggleSegment(int i0, int i1) {
+	auto tramos = delaunay0.tramosSegmento(i0,i1);
+	if (tramos.empty()) tramos = delaunay1.tramosSegmento(i0,i1); // si en delaunay0 ya no estan alineados
+	if (not tramos.empty()) {
+		for(const auto &s : tramos) {
+			delaunay0.eliminarSegmento(s.first,s.second);
+			delaunay1.eliminarSegmento(s.first,s.second);
+		}
+		return;
+	}
+	auto antes = delaunay0.getSegmentos(); // son los mismos en las dos
+	auto nuevos = [&](const Delaunay &d) {
+		std::vector<std::pair<int,int>> v;
+		for(auto s : d.getSegmentos()) {
+			if (s.first>s.second) std::swap(s.first,s.second);
+			if (std::find(antes.begin(),antes.end(),s)==antes.end() and
+				std::find(antes.begin(),antes.end(),std::make_pair(s.second,s.first))==antes.end())
+				v.push_back(s);
+		}
+		std::sort(v.begin(),v.end());
+		return v;
+	};
+	bool agregado = delaunay0.agregarSegmento(i0,i1) and delaunay1.agregarSegmento(i0,i1);
+	auto nuevos0 = nuevos(delaunay0), nuevos1 = nuevos(delaunay1);
+	if (agregado and nuevos0==nuevos1) return;
+	for(const auto &s : nuevos0) delaunay0.eliminarSegmento(s.first,s.second);
+	for(const auto &s : nuevos1) delaunay1.eliminarSegmento(s.first,s.second);
+}
+
 void resetCamera() {
 	view_target = {0.f,0.f,0.f}; view_pos = {0.f,0.f,3.f};
 	model_angle = 0.f; view_angle = 0.0f; view_fov = 45.f;
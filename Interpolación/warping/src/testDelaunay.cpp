@@ -0,0 +1,2 @@
+#include "testsDelaunay.hpp"
+PruebaDelaunay probar_delaunay;
@@ -0,0 +1,2 @@
+#include "testsPredicados.hpp"
+PruebaPredicados probar_predicados;
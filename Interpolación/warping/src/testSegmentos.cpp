@@ -0,0 +1,2 @@
+#include "testsSegmentos.hpp"
+PruebaSegmentos probar_segmentos;
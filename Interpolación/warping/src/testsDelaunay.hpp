@@ -0,0 +1,56 @@
+#ifndef TESTSDELAUNAY_HPP
+#define TESTSDELAUNAY_HPP
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "Delaunay.hpp"
+#include "testsPredicados.hpp"
+
+#define del_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba del Delaunay:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Mover y eliminar puntos (moverPunto/eliminarPunto): que despues de
+// movimientos cortos (dentro de la estrella, solo intercambios de diagonales)
+// y largos (desconectar y reconectar) la triangulacion siga siendo de
+// Delaunay con el punto en el destino, que un destino fuera del bounding box
+// se rechace sin cambiar nada, y que se puedan quitar todos los puntos
+struct PruebaDelaunay {
+	PruebaDelaunay() {
+		Delaunay d({-1.f,-1.f,0.f},{1.f,1.f,0.f},0.f);
+		std::minstd_rand rng(5);
+		std::uniform_real_distribution<float> u(-0.95f,0.95f), h(-0.02f,0.02f);
+		for(int i=0;i<200;++i)
+			del_assert(d.agregarPunto({u(rng),u(rng),0.f})!=-1);
+		del_assert(PruebaPredicados::esDelaunay(d));
+		
+		const int n = d.getPuntos().size();
+		for(int k=0;k<400;++k) {
+			int i = 4+rng()%(n-4);
+			glm::vec3 p = d.getPuntos()[i], q;
+			if (k%2) q = {p.x+h(rng),p.y+h(rng),0.f};
+			else q = {u(rng),u(rng),0.f};
+			del_assert(d.moverPunto(i,q));
+			del_assert(d.getPuntos()[i]==q and static_cast<int>(d.getPuntos().size())==n);
+			if (k%10==0) del_assert(PruebaPredicados::esDelaunay(d));
+		}
+		del_assert(PruebaPredicados::esDelaunay(d));
+		
+		// fuera del bounding box no se mueve
+		int version = d.getVersion();
+		glm::vec3 p = d.getPuntos()[4];
+		del_assert(not d.moverPunto(4,{1.5f,0.f,0.f}));
+		del_assert(d.getPuntos()[4]==p and d.getVersion()==version);
+		
+		// quitar todos (menos los 4 del bounding box), en cualquier orden
+		while (d.getPuntos().size()>4) {
+			d.eliminarPunto(4+rng()%(d.getPuntos().size()-4));
+			if (d.getPuntos().size()%20==0) del_assert(PruebaPredicados::esDelaunay(d));
+		}
+		del_assert(d.getTriangulos().size()==2 and PruebaPredicados::esDelaunay(d));
+	}
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef TESTSPREDICADOS_HPP
+#define TESTSPREDICADOS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Delaunay.hpp"
+#include "Predicados.hpp"
+
+#define pred_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de predicados:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Predicados (orient2d/incircle): el signo tiene que ser exacto aun en casos
+// donde el filtro en double no alcanza (puntos casi alineados o casi
+// cocirculares, lejos del origen), y una triangulacion de una grilla (todos
+// los cuadrados con sus 4 vertices cocirculares) tiene que salir valida
+struct PruebaPredicados {
+	static int signo(double v) { return v>0 ? 1 : (v<0 ? -1 : 0); }
+	
+	// todos los triangulos en sentido antihorario, vecinos reciprocos, ningun
+	// vertice opuesto estrictamente dentro de la circunferencia, y la cantidad
+	// de triangulos que corresponde a una caja de 4 esquinas (2n-6)
+	static bool esDelaunay(const Delaunay &d) {
+		const auto &pts = d.getPuntos();
+		const auto &tris = d.getTriangulos();
+		if (tris.size()!=2*pts.size()-6) return false;
+		for(int i=0;i<static_cast<int>(tris.size());++i) {
+			const glm::vec3 &a = pts[tris[i][0]], &b = pts[tris[i][1]], &c = pts[tris[i][2]];
+			if (orient2d(a.x,a.y,b.x,b.y,c.x,c.y)<=0) return false;
+			for(int k=0;k<3;++k) {
+				int v = tris[i].vecinos[k];
+				if (v==-1) continue;
+				int l = tris[v].indiceVecino(i);
+				if (l==-1) return false;
+				const glm::vec3 &q = pts[tris[v][l]];
+				if (incircle(a.x,a.y,b.x,b.y,c.x,c.y,q.x,q.y)>0) return false;
+			}
+		}
+		return true;
+	}
+	
+	PruebaPredicados() {
+		// a casi sobre la recta y=x (a 2^-53 de 0.5, por debajo del error
+		// del filtro): el signo solo depende de si a queda arriba o abajo
+		const double u = std::ldexp(1.0,-53);
+		for(int i=0;i<8;++i) {
+			for(int j=0;j<8;++j) {
+				double o = orient2d(0.5+i*u,0.5+j*u,12.0,12.0,24.0,24.0);
+				pred_assert(signo(o)==signo(j-i));
+			}
+		}
+		// circunferencia de radio 2^27 (los cuadrados ya no entran en un double):
+		// el cuarto punto sobre ella, apenas afuera (donde en double da 0) y adentro
+		const double r = std::ldexp(1.0,27);
+		pred_assert(incircle(r,0, 0,r, -r,0, 0,-r)==0);
+		pred_assert(incircle(r,0, 0,r, -r,0, 1,-r)<0);
+		pred_assert(incircle(r,0, 0,r, -r,0, 0,1-r)>0);
+		// en sentido horario se invierte
+		pred_assert(incircle(-r,0, 0,r, r,0, 0,1-r)<0);
+		
+		// grilla mezclada (peor caso de cocircularidad), sin tolerancia para que
+		// el resultado tenga que ser exactamente de Delaunay
+		const int n = 12;
+		std::vector<glm::vec3> grilla;
+		for(int i=1;i<n;++i) {
+			for(int j=1;j<n;++j) 
+				grilla.push_back({-1.f+2.f*i/n,-1.f+2.f*j/n,0.f});
+		}
+		std::shuffle(grilla.begin(),grilla.end(),std::minstd_rand(42));
+		Delaunay d({-1.f,-1.f,0.f},{1.f,1.f,0.f},0.f);
+		for(const glm::vec3 &p : grilla)
+			pred_assert(d.agregarPunto(p)!=-1);
+		pred_assert(d.getPuntos().size()==grilla.size()+4);
+		pred_assert(esDelaunay(d));
+		// y lo mismo de una vez (orden BRIO)
+		Delaunay d2({-1.f,-1.f,0.f},{1.f,1.f,0.f},0.f);
+		d2.agregarPuntos(grilla);
+		pred_assert(esDelaunay(d2));
+	}
+};
+
+#endif
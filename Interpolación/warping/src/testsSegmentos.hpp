@@ -0,0 +1,113 @@
+#ifndef TESTSSEGMENTOS_HPP
+#define TESTSSEGMENTOS_HPP
+
+#include <cstdlib>
+#include <iostream>
+#include "Delaunay.hpp"
+
+#define seg_assert(cond) if(!(cond)) {\
+	std::cerr << "Falla el caso de prueba de segmentos:\n   " << #cond << "\n";\
+	std::exit(1);\
+}
+
+// Segmentos fijos (agregarSegmento/eliminarSegmento): que se rechacen los que
+// cruzan otro, que la marca quede en los dos triangulos de la arista, que
+// sobrevivan a mover y eliminar otros puntos (y a mover sus extremos), que un
+// movimiento que haria cruzar dos segmentos se rechace sin perder ninguno, y
+// que uno que pasa por otros puntos se pueda encontrar (y quitar) por tramos
+struct PruebaSegmentos {
+	// cada arista marcada lo esta tambien del lado del vecino
+	bool marcasSimetricas(const Delaunay &d) {
+		const auto &tris = d.getTriangulos();
+		for(int i=0;i<static_cast<int>(tris.size());++i) {
+			for(int k=0;k<3;++k) {
+				int v = tris[i].vecinos[k];
+				if (v==-1) continue;
+				int l = tris[v].indiceVecino(i);
+				if (l==-1 or tris[v].restringida[l]!=tris[i].restringida[k]) return false;
+			}
+		}
+		return true;
+	}
+	PruebaSegmentos() {
+		Delaunay d({-2.f,-2.f,0.f},{2.f,2.f,0.f});
+		int a = d.agregarPunto({-1.f, 0.f,0.f}), b = d.agregarPunto({1.f,0.f,0.f});
+		int c = d.agregarPunto({ 0.f,-1.f,0.f}), e = d.agregarPunto({0.f,1.f,0.f});
+		int f = d.agregarPunto({ 1.f, 1.f,0.f}), g = d.agregarPunto({-1.f,-1.f,0.f});
+		
+		// agregar y la marca en los dos lados
+		seg_assert(d.agregarSegmento(a,b));
+		seg_assert(d.esSegmento(a,b) and d.esSegmento(b,a));
+		seg_assert(d.getSegmentos().size()==1);
+		seg_assert(marcasSimetricas(d));
+		
+		// uno que lo cruza se rechaza sin cambiar nada
+		int version = d.getVersion();
+		seg_assert(not d.agregarSegmento(c,e));
+		seg_assert(d.getVersion()==version);
+		seg_assert(d.getSegmentos().size()==1 and not d.esSegmento(c,e));
+		
+		// uno que no lo cruza si
+		seg_assert(d.agregarSegmento(e,f));
+		seg_assert(d.getSegmentos().size()==2 and marcasSimetricas(d));
+		
+		// mover otros puntos (poco, y lejos) y los extremos no los pierde
+		d.moverPunto(c,{0.1f,-0.9f,0.f});
+		d.moverPunto(g,{1.5f,-1.5f,0.f});
+		d.moverPunto(b,{1.1f,0.2f,0.f});
+		seg_assert(d.esSegmento(a,b) and d.esSegmento(e,f));
+		seg_assert(d.getSegmentos().size()==2 and marcasSimetricas(d));
+		
+		// eliminar un punto que no es extremo tampoco (g es el ultimo, asi que
+		// no se renumera ninguno)
+		d.eliminarPunto(g);
+		seg_assert(d.esSegmento(a,b) and d.esSegmento(e,f));
+		seg_assert(marcasSimetricas(d));
+		// y eliminar un extremo se lleva solo los suyos
+		d.eliminarPunto(f);
+		seg_assert(d.esSegmento(a,b) and d.getSegmentos().size()==1);
+		seg_assert(marcasSimetricas(d));
+		
+		// eliminar deja la arista libre, y una segunda vez no hace nada
+		seg_assert(d.eliminarSegmento(b,a));
+		seg_assert(not d.esSegmento(a,b) and d.getSegmentos().empty());
+		seg_assert(not d.eliminarSegmento(a,b));
+		seg_assert(marcasSimetricas(d));
+		
+		// ahora el que antes cruzaba si entra
+		seg_assert(d.agregarSegmento(c,e));
+		seg_assert(d.esSegmento(c,e) and marcasSimetricas(d));
+		
+		// uno que pasa por otro punto queda partido en dos tramos
+		int h = d.agregarPunto({-1.f,1.5f,0.f}), m = d.agregarPunto({0.f,1.5f,0.f});
+		int k = d.agregarPunto({ 1.f,1.5f,0.f});
+		seg_assert(d.agregarSegmento(h,k));
+		seg_assert(not d.esSegmento(h,k) and d.esSegmento(h,m) and d.esSegmento(m,k));
+		auto tramos = d.tramosSegmento(h,k);
+		seg_assert(tramos.size()==2 and tramos[0]==std::make_pair(h,m) and tramos[1]==std::make_pair(m,k));
+		seg_assert(d.tramosSegmento(k,h).size()==2 and d.tramosSegmento(c,e).size()==1);
+		seg_assert(d.tramosSegmento(h,e).empty());
+		
+		// llevar m al otro lado de c-e haria cruzar h-m con c-e: no se mueve, y
+		// quedan los mismos segmentos
+		seg_assert(not d.moverPunto(m,{0.5f,-1.5f,0.f}));
+		seg_assert(d.getPuntos()[m]==glm::vec3(0.f,1.5f,0.f));
+		seg_assert(d.getSegmentos().size()==3 and d.tramosSegmento(h,k).size()==2);
+		seg_assert(d.esSegmento(c,e) and marcasSimetricas(d));
+		// ni tampoco si m-k pasaria por e (y quedaria partido)
+		seg_assert(not d.moverPunto(m,{-1.f,0.5f,0.f}));
+		seg_assert(d.getSegmentos().size()==3 and d.tramosSegmento(h,k).size()==2);
+		// pero sin cruzar nada si
+		seg_assert(d.moverPunto(m,{0.f,1.8f,0.f}));
+		seg_assert(d.esSegmento(h,m) and d.esSegmento(m,k) and d.getSegmentos().size()==3);
+		
+		// quitar todos los tramos
+		seg_assert(d.moverPunto(m,{0.f,1.5f,0.f}));
+		for(const auto &s : d.tramosSegmento(h,k))
+			seg_assert(d.eliminarSegmento(s.first,s.second));
+		seg_assert(d.getSegmentos().size()==1 and d.esSegmento(c,e));
+		seg_assert(marcasSimetricas(d));
+	}
+};
+
+#endif
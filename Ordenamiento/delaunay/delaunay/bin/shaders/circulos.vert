@@ -0,0 +1,13 @@
+#version 330 core
+
+// vertexPosition: circunferencia unitaria, circulo: centro (xy) y radio (z)
+// de cada instancia; radio<0 => no se dibuja (queda fuera del volumen de vista)
+in vec2 vertexPosition;
+in vec3 circulo;
+
+uniform mat4 projectionMatrix;
+
+void main() {
+	if (circulo.z<0.f) gl_Position = vec4(2.f,2.f,2.f,1.f);
+	else gl_Position = projectionMatrix * vec4(circulo.xy+circulo.z*vertexPosition,0.f,1.f);
+}
@@ -0,0 +1,9 @@
+#version 330 core
+
+in vec2 vertexPosition;
+
+uniform mat4 projectionMatrix;
+
+void main() {
+	gl_Position = projectionMatrix * vec4(vertexPosition,0.f,1.f);
+}
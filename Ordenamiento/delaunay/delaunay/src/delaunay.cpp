@@ -2,42 +2,98 @@
 //////////////////   TRIANGULACION DELAUNAY 2D   ///////////////////////
 ////////////////////////////////////////////////////////////////////////
 
+#include <queue>
 #include "delaunay.h"
+#include "predicados.h"
 
 // Calcula si un punto esta o no dentro del circulo
-      //   C=c-p0=cc/aa; PT=pt-p0;
-      //   (PT-C)^2 <? r^2
-      //   r^2 = C^2 (origen en uno de los puntos)
-      //   (PT-C)^2 <? C^2
-      //   PT^2 - 2 PT.C - C^2 <? C^2
-      //   PT^2 <? 2 PT.C
+// Antes se hacia con el centro precalculado (PT^2*aa <? 2*PT.cc, con PT=pt-p0)
+// pero esos productos desbordan long long con coordenadas grandes, asi que
+// se usa el predicado incircle (signo exacto, ver predicados.h); los int
+// se representan exactamente en double
+
+// incircle con los tres vertices en orden (antihorario) y el punto
+static double incircle(const Dtri &t, const p2e &pt){
+  return incircle(t[0][0],t[0][1],t[1][0],t[1][1],t[2][0],t[2][1],pt[0],pt[1]);
+}
 
 // en el circulo o el borde (<=)
 bool Dtri::tiene_c(const p2e &pt) const{
-  p2e PT=pt-*(p[0]);
-  return (PT.mod2()*aa<=(PT[0]*cc[0]+PT[1]*cc[1])*2);
+  return incircle(*this,pt)>=0;
 }
 // interior estricto (<)
 bool Dtri::contiene_c(const p2e &pt) const{
-  p2e PT=pt-*(p[0]);
-  return (PT.mod2()*aa<(PT[0]*cc[0]+PT[1]*cc[1])*2);
+  return incircle(*this,pt)>0;
 }
 
 const int delaunay::tol=5;
 
-delaunay::~delaunay(){// destructor
-  while ((--deep)>=0) delete list[deep]; // borra los triangulos
-  // de destruir list se encarga el destructor de pila
+// anota el cambio, o descarta el registro si ya es mas grande que el pool
+void delaunay::marca(int it){
+  if (registro.size()>pool.size()+64) {
+    base_registro+=registro.size(); registro.clear();
+  }
+  registro.push_back(it);
+}
+
+// toma un triangulo del pool, reciclando el primero de la lista de libres
+int delaunay::nuevo(const p2e &p0, const p2e &p1, const p2e &p2){
+  ntris++;
+  int it=libres;
+  if (it<0) {pool.push_back(Dtri(p0,p1,p2)); it=int(pool.size())-1;}
+  else {libres=pool[it].vecino[0]; pool[it]=Dtri(p0,p1,p2);}
+  marca(it);
+  return it;
+}
+
+// lo marca libre y lo pone primero en la lista de libres
+void delaunay::libera(int it){
+  Dtri &t=pool[it];
+  t.p[0]=t.p[1]=t.p[2]=0;
+  t.vecino[0]=libres; t.vecino[1]=t.vecino[2]=-1;
+  libres=it; ntris--;
+  marca(it);
 }
 
 // inicializa con cuatro puntos del bbox en circulo (00 10 11 01)
 void delaunay::init(const p2e &p00,const p2e &p10,const p2e &p11,const p2e &p01){
-  while ((--deep)>=0) delete list[deep]; deep=0; // borra lo que hubiera de antes
+  pool.clear(); libres=-1; ntris=0; // borra lo que hubiera de antes
+  base_registro+=registro.size()+1; registro.clear(); // todo cambio
   ll=p00; ur=p11;
-  Dtri *t0=new Dtri(p00,p10,p01); push(t0);
-  Dtri *t1=new Dtri(p11,p01,p10); push(t1);
-  t0->vecino[0]=t1;t0->vecino[1]=0;t0->vecino[2]=0;
-  t1->vecino[0]=t0;t1->vecino[1]=0;t1->vecino[2]=0;
+  int t0=nuevo(p00,p10,p01);
+  int t1=nuevo(p11,p01,p10);
+  pool[t0].vecino[0]=t1;
+  pool[t1].vecino[0]=t0;
+  ultimo=t0;
+  rehace_grilla();
+}
+
+// celda de la grilla en la que cae el punto (si esta fuera, la del borde)
+int delaunay::celda(const p2e &p) const{
+  long long i=(long long)(p[0]-ll[0])*gn/(ur[0]-ll[0]+1);
+  long long j=(long long)(p[1]-ll[1])*gn/(ur[1]-ll[1]+1);
+  i=maximo(0LL,minimo((long long)(gn-1),i));
+  j=maximo(0LL,minimo((long long)(gn-1),j));
+  return int(j*gn+i);
+}
+
+// rehace la grilla con unos 4 triangulos por celda
+// busca el centro de cada celda recorriendo en zigzag, desde la celda anterior
+void delaunay::rehace_grilla(){
+  gn=1; while (4*(gn+1)*(gn+1)<=ntris) gn++;
+  grilla.assign(gn*gn,-1);
+  int i,j,k;
+  long long a[4];
+  int t=int(pool.size())-1; while (pool[t].libre()) t--;
+  for (j=0;j<gn;j++){
+    for (k=0;k<gn;k++){
+      i=(j&1)? gn-1-k: k;
+      p2e c(ll[0]+int((2LL*i+1)*(ur[0]-ll[0])/(2*gn)),
+            ll[1]+int((2LL*j+1)*(ur[1]-ll[1])/(2*gn)));
+      t=enquetriangulo(c,a,t);
+      grilla[j*gn+i]=t;
+    }
+  }
 }
 
 // verifica si esta dentro del bounding box
@@ -62,66 +118,75 @@ bool delaunay::test_en_box(const p2e &p) const{
                    i
 
 */
-static void Dswap(Dtri &t, Dtri &tv){  
-  int i=t.indice_vecino(tv),ix=tv.indice_vecino(t);
+void delaunay::swap(int it, int itv){
+  Dtri &t=pool[it], &tv=pool[itv];
+  int i=t.indice_vecino(itv),ix=tv.indice_vecino(it);
   // construye los nuevos triangulos
   Dtri nt(t[(i+1)%3],tv[ix],t[i]); // este reemplazara a t
   Dtri ntv(t[(i+2)%3],t[i],tv[ix]); // este reemplazara a tv
-  // arrega vecindades (punteros a triangulos)
-  nt.vecino[0]=&tv; ntv.vecino[0]=&t;
+  nt.f=t.f; ntv.f=tv.f; // conserva los flags
+  // arrega vecindades (indices de triangulos)
+  nt.vecino[0]=itv; ntv.vecino[0]=it;
   // estos dos siguen siendo vecinos de t y tv respectivamente
   nt.vecino[1]=t.vecino[(i+2)%3]; ntv.vecino[1]=tv.vecino[(ix+2)%3];
   // los otros dos cambian
-  Dtri *v;
-  v=tv.vecino[(ix+1)%3]; nt.vecino[2]=v; if (v) v->reemplaza_vecino(tv,t);
-  v=t.vecino[(i+1)%3]; ntv.vecino[2]=v; if (v) v->reemplaza_vecino(t,tv);
+  int v;
+  v=tv.vecino[(ix+1)%3]; nt.vecino[2]=v; if (v>=0) pool[v].reemplaza_vecino(itv,it);
+  v=t.vecino[(i+1)%3]; ntv.vecino[2]=v; if (v>=0) pool[v].reemplaza_vecino(it,itv);
   // reemplaza
   t=nt; tv=ntv;
+  marca(it); marca(itv);
 }
 
 // Restaura la triangulacion para que siga siendo Delaunay cuando algo cambio
 // En revisar estan los triangulos que se sabe que hay que revisar y se agregan los que se modifican
 // Labura mientras haya triangulos para revisar
 // El flag es para no poner un triangulo que ya esta en la pila
-static void Drestaura(pila_ptr<Dtri> &revisar){
+void delaunay::restaura(){
   static const int en_revisar=1;
   int i;
   // asigna el flag a los que ya estan dentro
-  for (i=0;i<revisar.deep;i++) revisar[i].f|=en_revisar;
+  for (size_t k=0;k<revisar.size();k++) pool[revisar[k]].f|=en_revisar;
   // revisa
-  while (revisar.deep) {
-    Dtri &t=revisar[--revisar.deep]; // referencia y lo saca de la pila
+  while (!revisar.empty()) {
+    int it=revisar.back(); // lo saca de la pila
+    Dtri &t=pool[it];
+    revisar.pop_back();
     t.f&=~en_revisar; // saca el flag de que esta en la lista
     // verifica contra los tres vecinos si cumplen Delaunay
     i=2; do{
-      Dtri *v=t.vecino[i];
-      if (!v) continue; // frontera
-      Dtri &tv=*v;
+      int iv=t.vecino[i];
+      if (iv<0) continue; // frontera
+      Dtri &tv=pool[iv];
       // verifica si cumplen delaunay
       if (!tv.contiene_c(t[i])) continue; // cumplen
       // no cumplen
-      revisar.deep++; t.f|=en_revisar; // repone t en la pila
-      if (!(tv.f&en_revisar)) {revisar.push(tv); tv.f|=en_revisar;} // agrega tv (si no estaba)
-      Dswap(t,tv); // swappea diagonales
+      revisar.push_back(it); t.f|=en_revisar; // repone t en la pila
+      if (!(tv.f&en_revisar)) {revisar.push_back(iv); tv.f|=en_revisar;} // agrega tv (si no estaba)
+      swap(it,iv); // swappea diagonales
       break; // t ya cambio => no sigue el loop en i
     }while (i--);
   }
 }
 
   // busca los elementos que tienen el punto
-bool delaunay::cluster(const p2e &p, pila_ptr<Dtri> &ptris){
-  int ix=3,i=deep;
-
-  // busca solo el primero aqui
-  while (i&&(ix==3)) ix=list[--i]->indice(p);
-  if (ix==3) return false; // ningun elemento tiene al punto (aislado??)
+bool delaunay::cluster(const p2e &p, std::vector<int> &ptris) const{
+  ptris.clear();
+  long long a[4];
+  // el triangulo donde cae p tiene que tenerlo como vertice
+  int i=enquetriangulo(p,a), ix=pool[i].indice(p);
+  if (ix==3) { // si no, lo busca en todos
+    i=pool.size();
+    while (i&&(ix==3)) {--i; if (!pool[i].libre()) ix=pool[i].indice(p);}
+    if (ix==3) return false; // ningun elemento tiene al punto (aislado??)
+  }
 
   // el i-esimo tiene al punto
-  Dtri *t=list[i],*t0=t;
+  int t=i,t0=t;
 
-  ptris.push(t0); // triangulos con p
+  ptris.push_back(t0); // triangulos con p
   // aqui busca los siguientes por vecindades
-  t=t0; while((t=t->vecino[(ix+1)%3])!=t0){ix=t->indice(p); ptris.push(t);}
+  while((t=pool[t].vecino[(ix+1)%3])!=t0){ix=pool[t].indice(p); ptris.push_back(t);}
   return true;
 }
 
@@ -129,37 +194,34 @@ bool delaunay::cluster(const p2e &p, pila_ptr<Dtri> &ptris){
 // Se asume que esta en alguno!!
 // Empieza desde start o uno cualquiera
 // a son las funciones de forma del punto en el triangulo
-Dtri& delaunay::enquetriangulo(const p2e &p, long long a[4], Dtri *start){
-  static const int visitado=1; //////////////////////////////////////////////////////////////////////////////////////////////sacar
-  pila_ptr<Dtri> visitados; // guarda en una pila para limpiar el flag antes de salir
-  Dtri *t=start; if (!t) t=list[deep-1]; // desde start o desde el ultimo
-  t->fforma(p,a);
+int delaunay::enquetriangulo(const p2e &p, long long a[4], int start) const{
+  int t=start; if (t<0) t=grilla[celda(p)]; // desde start o desde la grilla
+  if (pool[t].libre()) t=ultimo; // la semilla era de un triangulo que se libero
+  pool[t].fforma(p,a);
   // busca la funcion de forma mas negativa
   long long amin=a[0], imin=0;
   if (a[1]<amin) {amin=a[1],imin=1;}
   if (a[2]<amin) {amin=a[2],imin=2;}
   while (amin<0) { // significa que no esta dentro del triangulo)
-    t->f|=visitado; visitados.push(t);
-    t=t->vecino[imin];// -> pasa al vecino opuesto al punto mas alejado
+    t=pool[t].vecino[imin];// -> pasa al vecino opuesto al punto mas alejado
     // y recalcula
-    t->fforma(p,a);
+    pool[t].fforma(p,a);
     amin=a[0]; imin=0;
     if (a[1]<amin) {amin=a[1],imin=1;}
     if (a[2]<amin) {amin=a[2],imin=2;}
   }
-  // limpia flags
-  int &vd=visitados.deep; while(--vd>=0){visitados[vd].f&=~visitado;}
-  return *t;
+  return t;
 }
 
 // agrega un punto y repone Delaunay
 // si esta muy cerca de otro no agrega
 // si esta en la frontera de un triangulo lo mueve hacia dentro
-bool delaunay::agregapunto(p2e &p){
+bool delaunay::inserta(p2e &p, int tolerancia){
   if (!test_en_box(p)) return false;
   // seguro que esta dentro de un triangulo
   long long a[4], amin, imin, amed, imed, amax, imax;
-  Dtri &t=enquetriangulo(p,a); // el punto esta en t 
+  int it=enquetriangulo(p,a); // el punto esta en t 
+  const Dtri &t0=pool[it];
 
   // puede estar en la frontera o muy cerca de un nodo
   // ordena las funciones de forma
@@ -173,128 +235,252 @@ bool delaunay::agregapunto(p2e &p){
   }
 
   // verifica distancia al mas cercano
-  if (p.distanciac(t[imax])<tol) return false;
+  if (p.distanciac(t0[imax])<tolerancia) return false;
 
   // si esta en la frontera lo mueve una unidad dentro 
   // para evitar problemas (triangulo de area nula)
-  while (!amin){
-    // lo mueve hacia el que tiene funcion de forma nula
-    p2e dir=t[imin]-p;
-    // una unidad en direccion dir
-    if (abs(dir[0])>abs(dir[1]<<1)) // domina x
-      {dir[1]=0; dir[0]=(dir[0]>0)? 1: -1;}
-    else if (abs(dir[1])>abs(dir[0]<<1)) // domina y
-      {dir[0]=0; dir[1]=(dir[1]>0)? 1: -1;}
-    else // parejo
-      {dir[0]=(dir[0]>0)? 1: -1; dir[1]=(dir[1]>0)? 1: -1;}
-    p+=dir; // perturba el punto
-    p.fforma(t[0],t[1],t[2],a,true);
-    amin=minimo(a[0],minimo(a[1],a[2]));
+  if (!amin){
+    // si esa direccion es paralela a la arista (sigue en el borde) o lo saca
+    // del triangulo (triangulo muy fino), prueba las otras 7 direcciones
+    static const int d8[8][2]={{1,0},{1,1},{0,1},{-1,1},{-1,0},{-1,-1},{0,-1},{1,-1}};
+    p2e p0(p);
+    auto empuja=[&](const Dtri &t, int iv){
+      // lo mueve hacia el que tiene funcion de forma nula
+      p2e dir=t[iv]-p0;
+      // una unidad en direccion dir
+      if (abs(dir[0])>abs(dir[1]<<1)) // domina x
+        {dir[1]=0; dir[0]=(dir[0]>0)? 1: -1;}
+      else if (abs(dir[1])>abs(dir[0]<<1)) // domina y
+        {dir[0]=0; dir[1]=(dir[1]>0)? 1: -1;}
+      else // parejo
+        {dir[0]=(dir[0]>0)? 1: -1; dir[1]=(dir[1]>0)? 1: -1;}
+      int k=-1;
+      do {
+        if (k>=0) dir=p2e(d8[k][0],d8[k][1]);
+        p=p0+dir; // perturba el punto
+        p.fforma(t[0],t[1],t[2],a,true);
+        amin=minimo(a[0],minimo(a[1],a[2]));
+      } while (amin<=0&&++k<8);
+      return amin>0;
+    };
+    if (!empuja(t0,imin)){ // si no entra prueba del otro lado de la arista
+      int iv=t0.vecino[imin];
+      if (iv<0||!empuja(pool[iv],pool[iv].indice_vecino(it)))
+        {p=p0; return false;} // no hay lugar, no lo agrega
+      it=iv;
+    }
   }
 
   // esta dentro
   // une el punto con los tres vertices y forma dos nuevos triangulos
-  Dtri *nuevo[2]; // copia local de t porque lo va a modificar
-  nuevo[0]=new Dtri(p,t[2],t[0]); push(nuevo[0]);
-  nuevo[1]=new Dtri(p,t[0],t[1]); push(nuevo[1]);
+  // (primero los crea porque el pool puede realocar, y despues toma las referencias)
+  int nuevo0=nuevo(p,pool[it][2],pool[it][0]);
+  int nuevo1=nuevo(p,pool[it][0],pool[it][1]);
+  Dtri &t=pool[it], &n0=pool[nuevo0], &n1=pool[nuevo1];
   t.p[0]=&p; c3(t.p,t.cc,t.aa); // recalcula el viejo porque cambio un punto
+  marca(it);
 
   // arregla los vecinos
-  Dtri *v;
-  nuevo[0]->vecino[0]=v=t.vecino[1]; if (v) v->reemplaza_vecino(t,*nuevo[0]);
-  nuevo[0]->vecino[1]=nuevo[1]; 
-  nuevo[0]->vecino[2]=&t;
+  int v;
+  n0.vecino[0]=v=t.vecino[1]; if (v>=0) pool[v].reemplaza_vecino(it,nuevo0);
+  n0.vecino[1]=nuevo1; 
+  n0.vecino[2]=it;
 
-  nuevo[1]->vecino[0]=v=t.vecino[2]; if (v) v->reemplaza_vecino(t,*nuevo[1]);
-  nuevo[1]->vecino[1]=&t; 
-  nuevo[1]->vecino[2]=nuevo[0];
+  n1.vecino[0]=v=t.vecino[2]; if (v>=0) pool[v].reemplaza_vecino(it,nuevo1);
+  n1.vecino[1]=it; 
+  n1.vecino[2]=nuevo0;
 
-  t.vecino[1]=nuevo[0];
-  t.vecino[2]=nuevo[1];
+  t.vecino[1]=nuevo0;
+  t.vecino[2]=nuevo1;
 
   // Restaura Delaunay
-  pila_ptr<Dtri> revisar;
-  revisar.push(nuevo[0]); revisar.push(nuevo[1]); revisar.push(t);
-  Drestaura(revisar);
+  revisar.push_back(nuevo0); revisar.push_back(nuevo1); revisar.push_back(it);
+  restaura();
+
+  // actualiza la semilla de la celda (o rehace la grilla si quedo gruesa)
+  ultimo=it;
+  if (ntris>16*gn*gn) rehace_grilla();
+  else grilla[celda(p)]=it;
   return true;
 }
 
-// retestea delaunay al mover un punto
+// Mueve el punto: si la nueva posicion queda en el nucleo de su estrella (todos
+// sus triangulos siguen con area positiva) la topologia sigue valida y alcanza
+// con restaurar Delaunay con swaps desde esos triangulos (O(grado) por paso del
+// drag); si no, lo agrega en la nueva posicion y quita el viejo (y si ahi no
+// se puede, queda donde estaba)
 bool delaunay::muevepunto(p2e &p, const p2e &newpos){
-  int i,j;
+  size_t i,j;
   if (newpos==p) return true;
   if (!test_en_box(newpos)) return false;
   
   // busca los elementos que tienen el punto
-  pila_ptr<Dtri> ptris;
-  cluster(p,ptris);
+  if (!cluster(p,ptris)) return false;
   // verifica que no este demasiado cerca de otro
-  for(i=0;i<ptris.deep;i++){
-    const Dtri &t=ptris[i];
+  for(i=0;i<ptris.size();i++){
+    const Dtri &t=pool[ptris[i]];
     if (&t[0]!=&p && newpos.distanciac(t[0])<tol) return false;
     if (&t[1]!=&p && newpos.distanciac(t[1])<tol) return false;
     if (&t[2]!=&p && newpos.distanciac(t[2])<tol) return false;
   }
+  // ni de los del triangulo donde cae (si salio de la estrella)
+  long long a[4];
+  const Dtri &tn=pool[enquetriangulo(newpos,a,ptris[0])];
+  for(i=0;i<3;i++) if (&tn[i]!=&p && newpos.distanciac(tn[i])<tol) return false;
 
   // actualiza posicion (pero guarda la vieja por las dudas)
   p2e oldp(p); p=newpos; 
   // recalcula las circunferencias 
-  // y verifica si hay area negativa (movimiento brusco)
-  for(i=0;i<ptris.deep;i++){
-    Dtri &t=ptris[i];
+  // y verifica si hay area negativa (salio de la estrella)
+  for(i=0;i<ptris.size();i++){
+    Dtri &t=pool[ptris[i]];
     c3(t.p,t.cc,t.aa);
     if (t.aa<=0) { // area negativa o nula
-      // restituye todo como estaba y se va
+      // restituye todo como estaba
       p=oldp; // vuelve el punto a su pos original
       // restaura circulos modificados
       for (j=0;j<=i;j++){
-        Dtri &o=ptris[j];
+        Dtri &o=pool[ptris[j]];
         c3(o.p,o.cc,o.aa);
       }
-      return false;
+      // y lo reubica: agrega la nueva posicion como un punto auxiliar (la
+      // distancia a los demas ya se verifico), quita p y le pasa a p los
+      // triangulos del auxiliar; si no entra no se toco nada
+      p2e q(newpos);
+      if (!inserta(q,0)) return false;
+      quitapunto(p);
+      cluster(q,ptris);
+      p=q; // (puede haber quedado perturbado)
+      for (j=0;j<ptris.size();j++){
+        Dtri &t=pool[ptris[j]];
+        t.p[t.indice(q)]=&p;
+        marca(ptris[j]);
+      }
+      grilla[celda(p)]=ultimo=ptris[0];
+      return true;
     }
   }
 
   // todo bien asi que restaura Delaunay
-  Drestaura(ptris);
+  for(i=0;i<ptris.size();i++) marca(ptris[i]);
+  int t0=ptris[0]; // sigue cerca de p aunque se swapee
+  revisar.swap(ptris);
+  restaura();
+  grilla[celda(p)]=ultimo=t0;
   return true;
 }
 
-  // elimina un punto de la triangulacion
+// oreja del poligono que deja un punto al quitarlo (ver quitapunto)
+namespace {
+  struct oreja{
+    double potencia; // de p respecto de su circunferencia
+    int v, sello;    // vertice del medio y version de ese vertice al calcularla
+    bool operator<(const oreja &o) const {return potencia>o.potencia;} // la menor arriba
+  };
+}
+
+// Elimina un punto de la triangulacion retriangulando el hueco por orejas
+// (Devillers): los vecinos de p forman un poligono estrellado desde p y la
+// oreja convexa cuya circunferencia deja a p con la menor potencia es un
+// triangulo de Delaunay del poligono, asi que se corta esa y se sigue con el
+// poligono que queda. Las orejas estan en una cola de prioridad y al cortar una
+// solo cambian las de sus dos vecinos, asi que cuesta O(d log d) con d el grado
+// de p; no depende de poder swappear aristas de p (que con puntos alineados, como
+// en una grilla regular, puede no ser posible)
 bool delaunay::quitapunto(const p2e &p){
   // busca los elementos que tienen el punto
-  pila_ptr<Dtri> ptris; cluster(p,ptris);
-  pila_ptr<Dtri> revisar(ptris.deep);
-  // elimina aristas swapeando pares cuando las diagonales se cruzan
-  int j,i,ix;
-  while (ptris.deep>3){
-    for (j=0;j<ptris.deep;j++){
-      // en el swap es como que los triangulos "giran a la izquierda";inn
-      // necesito que el tv y no el t sea el que quede con p,
-      // ==> busco el vecino adecuado (indice de p + 1)
-      Dtri &t=ptris[j]; i=t.indice(p); // i=indice del punto en t      
-      Dtri &tv=t.v((i+1)%3); ix=tv.indice(p); // ix=indice del punto en tv
-      if (!hay_interseccion_estricta(p,t[(i+2)%3],t[(i+1)%3],tv[(ix+2)%3])) continue;
-      Dswap(t,tv); // tv queda con p y queda en ptris
-      revisar.push(t); // t se swappeo => hay que revisarlo (despues)      
-      ptris.remove(j); // t desaparece de ptris
+  if (!cluster(p,ptris)) return false;
+  int d=ptris.size(), i, k, a, c;
+  // vertice i del poligono: el que sigue a p en ptris[i]; la arista que va de
+  // i al siguiente es la opuesta a p en ptris[i], del otro lado esta ext[i]
+  // (y ptris[i] es su vecino lado[i]; al cortar orejas pasan a ser diagonales)
+  std::vector<const p2e*> v(d);
+  std::vector<int> ext(d), lado(d), ant(d), sig(d), sello(d,0);
+  for (i=0;i<d;i++){
+    const Dtri &t=pool[ptris[i]]; k=t.indice(p);
+    v[i]=t.p[(k+1)%3]; ext[i]=t.vecino[k];
+    lado[i]=(ext[i]<0)? 3: pool[ext[i]].indice_vecino(ptris[i]);
+    ant[i]=(i+d-1)%d; sig[i]=(i+1)%d;
+  }
+  // calcula la oreja con vertice i (si es convexa) y la encola
+  std::priority_queue<oreja> cola;
+  auto encola=[&](int j){
+    const p2e &pa=*v[ant[j]], &pb=*v[j], &pc=*v[sig[j]];
+    double o=orient2d(pa[0],pa[1],pb[0],pb[1],pc[0],pc[1]);
+    if (o<=0) return;
+    oreja e; e.v=j; e.sello=sello[j];
+    e.potencia=-incircle(pa[0],pa[1],pb[0],pb[1],pc[0],pc[1],p[0],p[1])/o;
+    cola.push(e);
+  };
+  // la oreja no puede tener otro vertice adentro ni en la diagonal (con la
+  // potencia exacta no pasa, esto cubre el redondeo)
+  auto vacia=[&](int j){
+    const p2e &pa=*v[ant[j]], &pb=*v[j], &pc=*v[sig[j]];
+    for (int l=sig[sig[j]];l!=ant[j];l=sig[l]){
+      const p2e &w=*v[l];
+      if (orient2d(pa[0],pa[1],pb[0],pb[1],w[0],w[1])>=0&&
+          orient2d(pb[0],pb[1],pc[0],pc[1],w[0],w[1])>=0&&
+          orient2d(pc[0],pc[1],pa[0],pa[1],w[0],w[1])>=0) return false;
     }
+    return true;
+  };
+  // el vecino k de it es e (que lo tiene como vecino l)
+  auto conecta=[&](int it, int kv, int e, int l){
+    pool[it].vecino[kv]=e; if (e>=0) pool[e].vecino[l]=it;
+  };
+  for (i=0;i<d;i++) encola(i);
+  // los triangulos nuevos van en los lugares de los primeros de ptris
+  int m=d, n=0;
+  bool reencoladas=false;
+  while (m>3){
+    i=0;
+    if (!cola.empty()){
+      oreja e=cola.top(); cola.pop();
+      i=e.v;
+      if (e.sello!=sello[i]||!vacia(i)) continue; // cambio o no sirve
+      reencoladas=false;
+    }
+    else if (!reencoladas){
+      // se descartaron todas las que quedaban (por el redondeo), se prueban
+      // otra vez; no se puede abandonar aca porque ya se reusaron triangulos
+      reencoladas=true;
+      for (int j=0;j<d;j++){
+        if (sello[j]<0) continue;
+        sello[j]++;
+        encola(j);
+      }
+      continue;
+    }
+    else {
+      // no hay ninguna convexa: lo que queda son puntos alineados (triangulos
+      // de area nula), asi que se corta cualquiera y restaura lo arregla
+      while (sello[i]<0) i++;
+    }
+    a=ant[i]; c=sig[i];
+    int it=ptris[n++];
+    pool[it]=Dtri(*v[a],*v[i],*v[c]); marca(it);
+    conecta(it,0,ext[i],lado[i]); // arista i-c
+    conecta(it,2,ext[a],lado[a]); // arista a-i
+    ext[a]=it; lado[a]=1; // la diagonal c-a queda como arista de a
+    sig[a]=c; ant[c]=a; m--;
+    sello[i]=-1; sello[a]++; sello[c]++;
+    encola(a); encola(c);
   }
-  // quedan 3, reemplaza, recalcula y elimina dos triangulos
-  Dtri *v;
-  Dtri &t=ptris[0]; i=t.indice(p); // este queda
-  // vuela el vecino i+1
-  Dtri &t1=t.v((i+1)%3); ix=t1.indice(p);
-  t.p[i]=t1.p[(ix+2)%3]; c3(t.p,t.cc,t.aa); // reemplaza y recalcula
-  v=t.vecino[(i+1)%3]=t1.vecino[ix]; if (v) v->reemplaza_vecino(t1,t);
-  remove(t1); delete &t1;
-  // vuela el vecino i+2
-  Dtri &t2=t.v((i+2)%3); ix=t2.indice(p);
-  v=t.vecino[(i+2)%3]=t2.vecino[ix]; if (v) v->reemplaza_vecino(t2,t);
-  remove(t2);  delete &t2;
-  
-  revisar.push(t);
-  Drestaura(revisar);
+  // queda un triangulo
+  for (i=0;sello[i]<0;i++);
+  a=ant[i]; c=sig[i];
+  int it=ptris[n++];
+  pool[it]=Dtri(*v[a],*v[i],*v[c]); marca(it);
+  conecta(it,0,ext[i],lado[i]);
+  conecta(it,1,ext[c],lado[c]);
+  conecta(it,2,ext[a],lado[a]);
+  // sobran dos
+  libera(ptris[d-1]);
+  libera(ptris[d-2]);
+
+  // restaura Delaunay (por el redondeo en la potencia) desde los nuevos
+  revisar.assign(ptris.begin(),ptris.begin()+n);
+  restaura();
+  grilla[celda(p)]=ultimo=ptris[0];
   return true;
 }
-
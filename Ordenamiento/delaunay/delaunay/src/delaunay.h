@@ -5,24 +5,25 @@
 #ifndef _DELAUNAY_
 #define _DELAUNAY_
 
+#include <vector>
 #include "p2e.h"
 
 // Triangulo Delaunay 
 class Dtri{
 public:
-  const p2e *p[3];  // punteros (variables) a puntos (intocables desde aca)
-  Dtri *vecino[3];  // punteros a vecinos adyacentes (tocables) 0=frontera
+  const p2e *p[3];  // punteros (variables) a puntos (intocables desde aca) p[0]=0 => libre
+  int vecino[3];    // indices (en el pool del delaunay) de los vecinos adyacentes -1=frontera
   long long aa;          // cuadruple del area => a=aa/4
   long long cc[2];       // cc=aa*(c-p0) => c=p0+cc/aa
   int f;            // flag multiproposito (bit a bit)
    
   // constructores
-//  Dtri(){p[0]=p[1]=p[2]=0; vecino[0]=vecino[1]=vecino[2]=0; aa=0; f=0;}
+  Dtri(){p[0]=p[1]=p[2]=0; vecino[0]=vecino[1]=vecino[2]=-1; aa=0; cc[0]=cc[1]=0; f=0;}
   Dtri(const Dtri& t){*this=t;}
   Dtri(const p2e &p0, const p2e &p1, const p2e &p2){
     p[0]=&p0; p[1]=&p1; p[2]=&p2;
     c3(p0,p1,p2,cc,aa);
-    vecino[0]=vecino[1]=vecino[2]=0;
+    vecino[0]=vecino[1]=vecino[2]=-1;
     f=0;
   }
 
@@ -35,7 +36,9 @@ public:
 //  }
 
   const p2e& operator[](int i) const {return *(p[i]);}
-  Dtri &v(int i) {return *(vecino[i]);}
+
+  // si esta en la lista de libres del pool (no es parte de la triangulacion)
+  bool libre() const {return !p[0];}
 
   // funciones de forma
   void fforma(const p2e &pt, long long *ai) const{
@@ -64,15 +67,15 @@ public:
     if (&pt==p[2]) return 2;
     return 3;
   }
-  int indice_vecino(const Dtri &t) const{ // si no esta devuelve 3
-    if (&t==vecino[0]) return 0;
-    if (&t==vecino[1]) return 1;
-    if (&t==vecino[2]) return 2;
+  int indice_vecino(int it) const{ // si no esta devuelve 3
+    if (it==vecino[0]) return 0;
+    if (it==vecino[1]) return 1;
+    if (it==vecino[2]) return 2;
     return 3;
   }
 
-  void reemplaza_vecino(Dtri &viejo, Dtri &nuevo){
-    vecino[indice_vecino(viejo)]=&nuevo;
+  void reemplaza_vecino(int viejo, int nuevo){
+    vecino[indice_vecino(viejo)]=nuevo;
   }
 
   // calcula los verdaderos centro y radio
@@ -87,41 +90,103 @@ public:
 };
 
 //===============================================================================
-// Delaunay "es" una pila de triangulos con mas datos y funciones especificas
-class delaunay: public pila_ptr<Dtri>{
+// Delaunay guarda los triangulos en un pool contiguo (un vector) y las
+// vecindades son indices en el pool; los triangulos que se eliminan quedan
+// libres (encadenados por vecino[0]) y se reciclan al crear otros, asi la
+// memoria no se fragmenta y los vecinos suelen quedar cerca en memoria
+class delaunay{
+  std::vector<Dtri> pool;
+  int libres; // primer triangulo libre del pool (-1 si no hay)
+  int ntris;  // cantidad de triangulos en uso
+  int ultimo; // un triangulo en uso (el ultimo que se toco), por si una semilla de la grilla quedo libre
+
+  // pilas de trabajo que se reutilizan entre operaciones para no alocar en cada una
+  std::vector<int> ptris, revisar;
+
+  // registro de cambios (ver cambios()) y cuantos se descartaron
+  std::vector<int> registro;
+  int base_registro;
+  // anota que el triangulo it se creo, modifico o libero
+  void marca(int it);
+
+  // toma un triangulo del pool (reciclando uno libre si hay) y devuelve su indice
+  // ojo: puede realocar el pool e invalidar las referencias a triangulos
+  int nuevo(const p2e &p0, const p2e &p1, const p2e &p2);
+  // devuelve un triangulo al pool (a la lista de libres)
+  void libera(int it);
+
+  // swap de la diagonal entre it y su vecino itv
+  void swap(int it, int itv);
+  // restaura Delaunay swappeando a partir de los triangulos de revisar (lo vacia)
+  void restaura();
+  // agrega el punto si no queda a menos de tolerancia de otro (ver agregapunto;
+  // muevepunto usa 0 porque ya verifico la distancia)
+  bool inserta(p2e &p, int tolerancia);
+
 public:
   p2e ll,ur; // bounding box (lower left, upper right)
   static const int tol; // minima distancia a otro punto o al bounding box
-  
-  delaunay(){};// constructor defalut sin nada
 
-  // destructor (borra los triangulos)
-  ~delaunay();
+  // grilla de gn x gn celdas sobre el bounding box con un triangulo cercano
+  // a cada celda, para arrancar desde ahi la busqueda de enquetriangulo
+  // (se actualiza al agregar, mover y quitar puntos y se rehace mas fina
+  // cuando hay demasiados triangulos por celda)
+  int gn;
+  std::vector<int> grilla;
+  
+  delaunay():libres(-1),ntris(0),ultimo(-1),base_registro(0),gn(0){};// constructor defalut sin nada
 
   // construye con cuatro puntos del bbox en orden circular (00 10 11 01)
-  delaunay(const p2e &p00,const p2e &p10,const p2e &p11,const p2e &p01)
+  delaunay(const p2e &p00,const p2e &p10,const p2e &p11,const p2e &p01):libres(-1),ntris(0),ultimo(-1),base_registro(0),gn(0)
     {init(p00,p10,p11,p01);}
 
   // inicializa con cuatro puntos del bbox en orden circular (00 10 11 01)
   void init(const p2e &p00,const p2e &p10,const p2e &p11,const p2e &p01);
 
+  // reserva lugar para los triangulos de unos n puntos (2 por punto)
+  void reserva(int n) {pool.reserve(2*n+2);}
+
+  // triangulos: se recorren de 0 a tamanio()-1 salteando los libre()
+  int tamanio() const {return pool.size();}
+  int cantidad() const {return ntris;} // cuantos estan en uso
+  Dtri &operator[](int i) {return pool[i];}
+  const Dtri &operator[](int i) const {return pool[i];}
+  Dtri &v(const Dtri &t, int i) {return pool[t.vecino[i]];} // vecino i de t
+
+  // registro de los triangulos que se crearon, modificaron (swap, punto movido)
+  // o liberaron, para que otras estructuras (voronoi) se actualicen sin
+  // recorrer todo: el cambio n (contando desde el primero) es
+  // cambios()[n-base_cambios()]; cuando el registro crece mas que el pool se
+  // descarta, y quien no lo leyo a tiempo tiene que recalcular todo
+  const std::vector<int> &cambios() const {return registro;}
+  int base_cambios() const {return base_registro;}
+  int total_cambios() const {return base_registro+int(registro.size());}
+
   // verifica si esta dentro del bounding box
   bool test_en_box(const p2e &p) const;
 
   // en que triangulo esta el punto (a=areas parciales y total para funciones de forma)
-  Dtri& enquetriangulo(const p2e &p, long long a[4], Dtri *start=0);
+  // si no se da start empieza desde el triangulo de la celda de p en la grilla
+  int enquetriangulo(const p2e &p, long long a[4], int start=-1) const;
+
+  // celda de la grilla en la que cae el punto
+  int celda(const p2e &p) const;
+
+  // arma la grilla de nuevo (unos 4 triangulos por celda)
+  void rehace_grilla();
 
-  // busca los elementos que tienen el punto
-  bool cluster(const p2e &p, pila_ptr<Dtri> &ptris);
+  // busca los elementos que tienen el punto (indices, en orden alrededor del punto)
+  bool cluster(const p2e &p, std::vector<int> &ptris) const;
 
   // agrega un punto y repone Delaunay
   // p no es const porque puede resultar perturbado
-  bool agregapunto(p2e &p);
+  bool agregapunto(p2e &p) {return inserta(p,tol);}
 
-  // retestea delaunay al mover un punto
+  // mueve un punto: si no sale de su estrella solo swappea, si no lo agrega en
+  // la nueva posicion y quita el viejo; false si no se pudo (queda donde estaba)
   bool muevepunto(p2e &p, const p2e &newpos);
 
-  // elimina un punto de la triangulacion
+  // elimina un punto de la triangulacion (retriangula el hueco por orejas)
   bool quitapunto(const p2e &p);
   
   // retorna true si es una de los puntos "virtuales"
@@ -3,13 +3,14 @@
 
 using namespace std;
 
-bool graba(const char *fname, const delaunay &D, const pila_ptr<p2e> &puntos){
+bool graba(const char *fname, const delaunay &D){
   int i;
   ofstream f(fname);
   if (!f.is_open()) return false;
-  for (i=0;i<D.deep;i++){
+  for (i=0;i<D.tamanio();i++){
     const Dtri &t=D[i];
-    f << &t << "\t"
+    if (t.libre()) continue;
+    f << i << "\t"
       << t.p[0] << ","
       << t.p[1] << ","
       << t.p[2] << "\t"
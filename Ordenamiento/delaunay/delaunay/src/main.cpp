@@ -1,443 +1,222 @@
-#include <iostream> // cin, cout
-#include <cstdlib> // exit
+#include <iostream> // cout
+#include <cstdlib> // rand
 #include <ctime> // time
-#include <cmath> // fabs
-#include <GL/glut.h>
+#include <cmath> // pow
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include "Window.hpp"
+#include "Callbacks.hpp"
 
 #include "utiles.h"
 #include "p2e.h"
 #include "delaunay.h"
+#include "voronoi.h"
+#include "visor.h"
 
 using namespace std;
 
-// comentar este bloque si se quiere una ventana de comando
-//#ifdef _WIN32
-// #pragma comment( linker, "/subsystem:\"windows\" /entry:\"mainCRTStartup\"" )
-//#endif
-
 // variables
 static int
-  tol=15; // tolerancia para seleccionar un punto
-
-static GLfloat // luces y colores en float;
-  linewidth=1,pointsize=5,
-  fondo[]={0.95f,0.98f,1.0},       // color de fondo
-  delaunay_color[]={.2f,.2f,.6f},
-  voronoi_color[]={.6f,.2f,.2f},
-  circle_color[]={.2f,.6f,.6f},
-  vertex_color[]={.1f,.1f,.3f},
-  center_color[]={.3f,.1f,.1f};
-
-static bool
-  changemenu=false, // avisa que hay que modificar el menu
-  cl_info=true;     // informa por la linea de comandos;
+  tol=15; // tolerancia para seleccionar un punto (en pixeles)
 
-static short modifiers=0;  // ctrl, alt, shift (de GLUT)
+static bool cl_info=true; // informa por la linea de comandos
 
 // delaunay
 static delaunay D; // una instancia de la clase
+static Voronoi V; // su diagrama de voronoi (se actualiza al dibujar y al buscar)
 static pila_ptr<p2e> puntos; // listas de puntos
 static p2e *pt=0; // el punto que se agrega mueve o borra
-static bool dibujar_c=false, dibujar_t=false, dibujar_v=false;
-
-// funciones
-static void check_gl_error(){
-//#ifdef _DEBUG
-  // chequea errores
-  int errornum=glGetError();
-  while(errornum!=GL_NO_ERROR){
-    if (cl_info){
-           if(errornum==GL_INVALID_ENUM)
-             cout << "GL_INVALID_ENUM" << endl;
-      else if(errornum==GL_INVALID_VALUE)
-             cout << "GL_INVALID_VALUE" << endl;
-      else if (errornum==GL_INVALID_OPERATION)
-             cout << "GL_INVALID_OPERATION" << endl;
-      else if (errornum==GL_STACK_OVERFLOW)
-             cout << "GL_STACK_OVERFLOW" << endl;
-      else if (errornum==GL_STACK_UNDERFLOW)
-             cout << "GL_STACK_UNDERFLOW" << endl;
-      else if (errornum==GL_OUT_OF_MEMORY)
-             cout << "GL_OUT_OF_MEMORY" << endl;
-    }
-    errornum=glGetError();
-  }
-//#endif // _DEBUG
-}
-
-static void salir(){
-  exit(EXIT_SUCCESS);
-}
-
-static void circulo_Bresenham(int xc, int yc, int r) {
-  glPointSize(linewidth); // si, la circunferencia es una linea
-  glBegin(GL_POINTS);
-  int x=0, y=r, h=1-r, E=3, SE=5-(r<<1);
-  while (y>x){
-    glVertex2i( x+xc, y+yc);
-    glVertex2i( x+xc,-y+yc);
-    glVertex2i(-x+xc, y+yc);
-    glVertex2i(-x+xc,-y+yc);
-
-    glVertex2i( y+xc, x+yc);
-    glVertex2i( y+xc,-x+yc);
-    glVertex2i(-y+xc, x+yc);
-    glVertex2i(-y+xc,-x+yc);
-    if (h>=0){ // SE
-      h+=SE; E+=2; SE+=4;
-      y--;
-    }
-    else { // E
-      h+=E; E+=2; SE+=2;
-    }
-    x++;
-  }
-  // x==y => no hace falta intercambiar
-  glVertex2i( x+xc, y+yc);
-  glVertex2i( x+xc,-y+yc);
-  glVertex2i(-x+xc, y+yc);
-  glVertex2i(-x+xc,-y+yc);
-  glEnd();
-  glPointSize(pointsize);
-}
-
-//--------
-static void dibuja(){
-  if (!puntos) return;
-  int i,j,r,rv,ntris=D.deep, npoints=puntos.deep;
-  p2e c,cv;
+static int ipt=-1; // y su posicion en puntos
+static bool dibujar_c=false, dibujar_t=true, dibujar_v=false;
+static visor *vis=0; // los buffers con lo que se dibuja (necesita el contexto)
 
-  // triangulos circulos y voronoi
-  for(j=0;j<ntris;j++){
-    Dtri &t=D[j]; if (dibujar_c||dibujar_v) t.circulo(c,r);
-    // circunferencias
-    if (dibujar_c) {
-			if ((D.esvirtual(t[0])?1:0)+(D.esvirtual(t[1])?1:0)+(D.esvirtual(t[2])?1:0)==0) {
-				glColor3fv(circle_color);
-				circulo_Bresenham(c[0],c[1],r);
-			}
-    }
-    if (dibujar_v){
-      glColor3fv(voronoi_color);
-      // dibuja una linea entre el centro de este triangulo y el de cada vecino
-      // para hacerlo solo una vez (no a-b y b-a) va del de mayor puntero al de menor puntero
-      // cuando es vecino de la frontera dibuja una linea (larga) perpendicular a la frontera
-      Dtri *v;
-      i=2; do{
-        v=t.vecino[i];
-        if(v>&t) continue; // compara punteros para hacer una sola linea por par
-        glBegin(GL_LINES);
-        glVertex2iv(c);
-        if (!v) cv=c+((t[(i+1)%3]-t[(i+2)%3]).giro90())*2; // frontera
-        else v->circulo(cv,rv);// hay vecino
-        glVertex2iv(cv);
-        glEnd();
-      } while(i--);
-    }
-    // triangulos
-    if (dibujar_t) {
-      glColor3fv(delaunay_color);
-      glBegin(GL_LINE_STRIP);
-      if (!D.esvirtual(t[0])) glVertex2iv(t[0]);
-			if (!D.esvirtual(t[1])) glVertex2iv(t[1]);
-			if (!D.esvirtual(t[2])) glVertex2iv(t[2]);
-			if (!D.esvirtual(t[0])) glVertex2iv(t[0]);
-      glEnd();
-    }
-  }
-  // puntos
-  glPointSize(pointsize);
-  glColor3fv(vertex_color);
-  glBegin(GL_POINTS);
-  for(j=0;j<npoints;j++) glVertex2iv(puntos[j]);
-  glEnd();
-}
+// vista: el pixel (0,0) de la ventana es el punto (xv0,yv0) y cada unidad son
+// escala pixeles (con escala=1 es como el glOrtho(0,w,h,0) de la version GLUT)
+static double xv0=0, yv0=0, escala=1;
+static bool arrastrando=false, paneando=false;
+static double xm_ant, ym_ant; // posicion anterior del mouse al panear
 
-//============================================================
 // callbacks
+void keyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+void mouseMoveCallback(GLFWwindow* window, double xpos, double ypos);
+void scrollCallback(GLFWwindow* window, double xoffset, double yoffset);
 
-//------------------------------------------------------------
-// redibuja los objetos
-// Cada vez que hace un redisplay
-void Display_cb() { // Este tiene que estar
-  // borra el buffer de pantalla
-  glClear(GL_COLOR_BUFFER_BIT);
-  dibuja();
-  glutSwapBuffers();
-  check_gl_error();
+static p2e a_mundo(double x, double y){
+  return p2e(redondea(xv0+x/escala),redondea(yv0+y/escala));
 }
 
-//------------------------------------------------------------
-// Maneja cambios de ancho y alto del screen
-void Reshape_cb(int w, int h){
-  //if (cl_info) cout << "reshape " << w << "x" << h << endl;
-
-  glViewport(0,0,w,h); // region donde se dibuja
-
-  // matriz de proyeccion
-  glMatrixMode(GL_PROJECTION);  glLoadIdentity();
-  glOrtho(0,w,h,0,-1,1);
-
-  glutPostRedisplay();
-}
-
-
-//------------------------------------------------------------
-// Teclado y Mouse
-// GLUT ACTIVE SHIFT Set if the Shift modifier or Caps Lock is active.
-// GLUT ACTIVE CTRL  Set if the Ctrl modifier is active.
-// GLUT ACTIVE ALT   Set if the Alt modifier is active.
-
-static inline short get_modifiers() {return modifiers=(short)glutGetModifiers();}
-
-// Maneja pulsaciones del teclado (ASCII keys)
-// x,y posicion del mouse cuando se teclea
-void Keyboard_cb(unsigned char key,int x=0,int y=0) {
-  if (key==27){ // escape => exit
-    get_modifiers();
-    if (!modifiers) salir();
-  }
-  else if (key=='i'||key=='I'){ // info
-    cl_info=!cl_info;
-    cout << ((cl_info)? "Info" : "Sin Info") << endl;
+static void borra(){ // borra pt
+  if (!pt||puntos.deep<=4) return;
+  if (!D.quitapunto(*pt)){ // no esta en la triangulacion: se deja como esta
+    cout << "No se pudo quitar el punto " << pt->x << "," << pt->y << endl;
     return;
   }
-  else if (key==127){ // del => borra pt
-    if (!pt||puntos.deep<=4) return;
-    D.quitapunto(*pt);
-    puntos.remove(pt);
-    delete pt; pt=0;
-	  glutPostRedisplay();
-    return;
-  }
-  else if (key=='t'||key=='T'){ // Triangulos
-    dibujar_t=!dibujar_t;
-    if (cl_info) {
-      if (dibujar_t) cout << "Dibuja Triangulos" << endl;
-      else cout << "No Dibuja Triangulos" << endl;
-    }
-	  glutPostRedisplay();
-    changemenu=true;
-    return;
-  }
-  else if (key=='c'||key=='C'){ // Circunferencias
-    dibujar_c=!dibujar_c;
-    if (cl_info) {
-      if (dibujar_c) cout << "Dibuja Circunferencias" << endl;
-      else cout << "No Dibuja Circunferencias" << endl;
-    }
-	  glutPostRedisplay();
-    changemenu=true;
-    return;
+  puntos.remove(ipt); // pasa el ultimo a su lugar
+  if (ipt<puntos.deep) vis->punto(ipt,puntos[ipt]);
+  vis->cantidad_puntos(puntos.deep);
+  delete pt; pt=0; ipt=-1; arrastrando=false;
+}
+
+// en lugar de quitar los puntos de a uno arranca de nuevo con el bounding box
+static void borra_todo(){
+  while (puntos.deep>4) delete puntos.pop();
+  D.init(puntos[0],puntos[1],puntos[2],puntos[3]);
+  vis->cantidad_puntos(puntos.deep);
+  pt=0; ipt=-1; arrastrando=false;
+}
+
+// agrega n puntos al azar en la parte visible del bounding box
+static int agrega_al_azar(GLFWwindow *window, int n){
+  int w,h,agregados=0; glfwGetFramebufferSize(window,&w,&h);
+  p2e a=a_mundo(0,0), b=a_mundo(w,h);
+  int xa=maximo(a[0],D.ll[0]+delaunay::tol), xb=minimo(b[0],D.ur[0]-delaunay::tol),
+      ya=maximo(a[1],D.ll[1]+delaunay::tol), yb=minimo(b[1],D.ur[1]-delaunay::tol);
+  if (xb<=xa||yb<=ya) return 0;
+  D.reserva(puntos.deep+n);
+  for (int i=0;i<n;i++){
+    p2e *p=new p2e(xa+rand()%(xb-xa),ya+rand()%(yb-ya));
+    if (!D.agregapunto(*p)) {delete p; continue;}
+    puntos.push(p); vis->punto(puntos.deep-1,*p); agregados++;
   }
-  else if (key=='v'||key=='V'){ // Voronoi
-    dibujar_v=!dibujar_v;
-    if (cl_info) {
-      if (dibujar_v) cout << "Dibuja Voronoi" << endl;
-      else cout << "No Dibuja Voronoi" << endl;
-    }
-	  glutPostRedisplay();
-    changemenu=true;
-    return;
-  }
-  else if (key=='b'||key=='B'){ // Borra Todo
-    while (puntos.deep>4) {
-			pt = puntos.pop();
-			D.quitapunto(*pt); 
-			delete pt; 
-		} 
-		pt=0;
-	  glutPostRedisplay();
-    return;
-  }
-}
-
-// Special keys (non-ASCII)
-//  GLUT KEY F[1,12] F[1,12] function key.
-//  GLUT KEY LEFT Left directional key.
-//  GLUT KEY UP Up directional key.
-//  GLUT KEY RIGHT Right directional key.
-//  GLUT KEY DOWN Down directional key.
-//  GLUT KEY PAGE UP Page up directional key.
-//  GLUT KEY PAGE DOWN Page down directional key.
-//  GLUT KEY HOME Home directional key.
-//  GLUT KEY END End directional key.
-//  GLUT KEY INSERT Inset directional key.
-
-// aca es int key
-void Special_cb(int key,int xm=0,int ym=0) {
-  if (key==GLUT_KEY_F4){ // alt+f4 => exit
-    get_modifiers();
-    if (modifiers==GLUT_ACTIVE_ALT) salir();
-  }
-}
-
-// Menu
-void Menu_cb(int value) {
-  Keyboard_cb(value);
+  return agregados;
 }
 
-void Menu_changer(int status, int x, int y){
-  if (!changemenu) return;
-  if (status==GLUT_MENU_IN_USE) 
-    return;
-  
-  if (dibujar_t) glutChangeToMenuEntry(1, "[t] No Dibujar Triangulos", 't');
-  else glutChangeToMenuEntry(1, "[t] Dibujar Triangulos", 't');
-
-  if (dibujar_c) glutChangeToMenuEntry(2, "[c] No Dibujar Circunferencias", 'c');
-  else glutChangeToMenuEntry(2, "[c] Dibujar Circunferencias", 'c');
-  
-  if (dibujar_v) glutChangeToMenuEntry(3, "[v] No Dibujar Voronoi", 'v');
-  else glutChangeToMenuEntry(3, "[v] Dibujar Voronoi", 'v');
-    
-  changemenu=false;
-}
-
-
-// Movimientos del mouse
-
-void Passive_Motion_cb(int x, int y){ // cualquier movimiento del mouse
-  cout << "\r" << x << ',' << y;
-}
-
-void Motion_cb(int x, int y){ // drag
-  cout << "\r" << x << ',' << y;
-  if (!pt) return;
-  p2e pm(x,y);
-  if (D.muevepunto(*pt,pm)) glutPostRedisplay();
-  else pt=0;
-}
-
-// Clicks del mouse
-// GLUT LEFT BUTTON, GLUT MIDDLE BUTTON, or GLUT RIGHT BUTTON
-// The state parameter is either GLUT UP or GLUT DOWN
-// glutGetModifiers may be called to determine the state of modifier keys
-void Mouse_cb(int button, int state, int x, int y){
-  if (button==GLUT_LEFT_BUTTON){
-    if (state==GLUT_DOWN) {
-      // selecciona para mover o borrar
-      p2e pm(x,y); pt=0;
-      // verifica tolerancia
-      int len=puntos.deep;
-      while(puntos.deep>4) {
-        pt=(p2e*)puntos.pop();
-        if (pm.distanciac(*pt)<tol) break;
-        pt=0;
-      }puntos.deep=len;
-      if (!pt) {// agrega // agrega un punto
-        pt=new p2e(pm); puntos.push(pt);
-        if (D.agregapunto(*pt)) glutPostRedisplay();
-        else {puntos.deep--; delete pt; pt=0;}
-      }
-      // pt es el punto a editar
-      glutMotionFunc(Motion_cb); // mueve
-      return;
-    } // down
-    else if (state==GLUT_UP){
-      glutMotionFunc(0); // anula el callback para los drags
-      return;
-    } // up
-  } // left
-}
-
-
-int integerv(GLenum pname){
-  int value;
-  glGetIntegerv(pname,&value);
-  return value;
-}
-#define _PRINT_INT_VALUE(pname) #pname << ": " << integerv(pname) <<endl
-
 //------------------------------------------------------------
-// Inicializa GLUT y OpenGL
-void initialize() {
-  // pide color RGB y double buffering
-  glutInitDisplayMode(GLUT_RGB|GLUT_DOUBLE);
-
-  glutInitWindowSize(800,600); glutInitWindowPosition(50,50);
-
-  glutCreateWindow("Delaunay"); // crea el main window
-
-  //declara los callbacks
-  //los que no se usan no se declaran
-  glutDisplayFunc(Display_cb); // redisplays
-  glutReshapeFunc(Reshape_cb); // resize
-  glutKeyboardFunc(Keyboard_cb); // teclado
-  glutSpecialFunc(Special_cb); // ctrl alt y shift
-  glutMouseFunc(Mouse_cb); // clicks
-  glutPassiveMotionFunc(Passive_Motion_cb); // movimientos sin click
-
-  glutCreateMenu(Menu_cb);
-    if (dibujar_t)
-      glutAddMenuEntry("[t] No Dibujar Triangulos", 't');
-    else
-      glutAddMenuEntry("[t] Dibujar Triangulos", 't');
-    if (dibujar_c)
-      glutAddMenuEntry("[c] No Dibujar Circunferencias", 'c');
-    else
-      glutAddMenuEntry("[c] Dibujar Circunferencias", 'c');
-    if (dibujar_v)
-      glutAddMenuEntry("[v] No Dibujar Voronoi", 'v');
-    else
-      glutAddMenuEntry("[v] Dibujar Voronoi", 'v');
-      glutAddMenuEntry("---------------------------", 255);
-      glutAddMenuEntry("[Del] Borra", 127);
-      glutAddMenuEntry("[b] Borra Todo", 'b');
-      glutAddMenuEntry("---------------------------", 255);
-      glutAddMenuEntry("[i] Info ON/OFF", 'i');
-      glutAddMenuEntry("[Esc] Exit", 27);
-  glutAttachMenu(GLUT_RIGHT_BUTTON);
-  glutMenuStatusFunc(Menu_changer);
-
-  // ========================
-  // estado normal del OpenGL
-  // ========================
-  glClearColor(fondo[0],fondo[1],fondo[2],1);  // color de fondo
-  glDrawBuffer(GL_BACK);
-  glMatrixMode(GL_MODELVIEW); glLoadIdentity(); // constante
-  glShadeModel(GL_FLAT); // no interpola color
-  glLineWidth(linewidth);
+// main
+int main() {
+  Window window(800,600,"Delaunay",Window::fAntialiasing|Window::fVSync);
+  glfwSetFramebufferSizeCallback(window, common_callbacks::viewResizeCallback);
+  glfwSetKeyCallback(window, keyboardCallback);
+  glfwSetMouseButtonCallback(window, mouseButtonCallback);
+  glfwSetCursorPosCallback(window, mouseMoveCallback);
+  glfwSetScrollCallback(window, scrollCallback);
 
-  // ========================
-  // info
   if (cl_info)
     cout << "Vendor:         " << glGetString(GL_VENDOR) << endl
          << "Renderer:       " << glGetString(GL_RENDERER) << endl
-         << "GL_Version:     " << glGetString(GL_VERSION) << endl
-         << "GL_Extensions:  " << glGetString(GL_EXTENSIONS) << endl
-         << "GLU_Version:    " << gluGetString(GLU_VERSION) << endl
-         << "GLU_Extensions: " << gluGetString(GLU_EXTENSIONS) << endl
-         << _PRINT_INT_VALUE(GL_DOUBLEBUFFER)
-         << _PRINT_INT_VALUE(GL_STEREO)
-         << _PRINT_INT_VALUE(GL_AUX_BUFFERS)
-         << _PRINT_INT_VALUE(GL_RED_BITS)
-         << _PRINT_INT_VALUE(GL_GREEN_BITS)
-         << _PRINT_INT_VALUE(GL_BLUE_BITS)
-         << _PRINT_INT_VALUE(GL_ALPHA_BITS)
-         << _PRINT_INT_VALUE(GL_DEPTH_BITS)
-         << _PRINT_INT_VALUE(GL_STENCIL_BITS)
-         << _PRINT_INT_VALUE(GL_ACCUM_RED_BITS)
-         << _PRINT_INT_VALUE(GL_ACCUM_GREEN_BITS)
-         << _PRINT_INT_VALUE(GL_ACCUM_BLUE_BITS)
-         << _PRINT_INT_VALUE(GL_ACCUM_ALPHA_BITS)
-         ;
-  // ========================
+         << "GL_Version:     " << glGetString(GL_VERSION) << endl;
+
+  visor visor_delaunay; vis=&visor_delaunay;
+  glClearColor(vis->color_fondo.x,vis->color_fondo.y,vis->color_fondo.z,1);
 
- 
   //inicializa delaunay
+  srand(time(0));
   p2e ll(-10000,-10000),ur(20000,20000); // bounding box
   p2e *b0=new p2e(ll),*b1=new p2e(ur,ll),
       *b2=new p2e(ur),*b3=new p2e(ll,ur);
   puntos.push(b0);puntos.push(b1);puntos.push(b2);puntos.push(b3);
   D.init(*b0,*b1,*b2,*b3);
+  vis->puntos(puntos);
+
+  FrameTimer ftime;
+  int al_azar=10000;
+  do {
+    ftime.newFrame();
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // y hacia abajo, como las coordenadas del mouse
+    int w,h; glfwGetFramebufferSize(window,&w,&h);
+    glm::mat4 proyeccion=glm::ortho(float(xv0),float(xv0+w/escala),float(yv0+h/escala),float(yv0),-1.f,1.f);
+    vis->actualizar(D,V);
+    vis->dibujar(proyeccion,dibujar_t,dibujar_c,dibujar_v);
+
+    window.ImGuiDialog("Delaunay",[&](){
+      ImGui::Checkbox("Triangulos (T)",&dibujar_t);
+      ImGui::Checkbox("Circunferencias (C)",&dibujar_c);
+      ImGui::Checkbox("Voronoi (V)",&dibujar_v);
+      ImGui::Separator();
+      ImGui::InputInt("##n",&al_azar);
+      ImGui::SameLine();
+      if (ImGui::Button("Al azar")) {
+        double t=glfwGetTime();
+        int n=agrega_al_azar(window,maximo(al_azar,0));
+        if (cl_info) cout << n << " puntos en " << glfwGetTime()-t << "s" << endl;
+      }
+      if (ImGui::Button("Borra (Del)")) borra();
+      ImGui::SameLine();
+      if (ImGui::Button("Borra Todo (B)")) borra_todo();
+      ImGui::Separator();
+      ImGui::Text("Puntos: %i  Triangulos: %i",puntos.deep-4,D.cantidad());
+      ImGui::Text("Zoom: %.3g  FPS: %i",escala,ftime.getFrameRate());
+      ImGui::TextDisabled("Izq: agrega/mueve  Der: pan  Rueda: zoom");
+    });
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  } while( glfwGetKey(window,GLFW_KEY_ESCAPE)!=GLFW_PRESS && !glfwWindowShouldClose(window) );
+
+  while (puntos.deep) delete puntos.pop();
+  vis=0;
+  return 0;
 }
 
-//------------------------------------------------------------
-// main
-int main(int argc,char** argv) {
-  glutInit(&argc,argv);// inicializa glut
-  initialize(); // condiciones iniciales de la ventana y OpenGL
-  glutMainLoop(); // entra en loop de reconocimiento de eventos
-  return 0; //solo para que el builder se quede tranquilo (aqui nunca llega)
+//============================================================
+// callbacks
+
+// teclado: atajos para las opciones
+void keyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+  if (action!=GLFW_PRESS) return;
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureKeyboard) return;
+  switch (key){
+    case 'I': // info
+      cl_info=!cl_info;
+      cout << ((cl_info)? "Info" : "Sin Info") << endl;
+      break;
+    case GLFW_KEY_DELETE: borra(); break;
+    case 'T': dibujar_t=!dibujar_t; break; // Triangulos
+    case 'C': dibujar_c=!dibujar_c; break; // Circunferencias
+    case 'V': dibujar_v=!dibujar_v; break; // Voronoi
+    case 'B': borra_todo(); break; // Borra Todo
+  }
+}
+
+// Clicks del mouse: el izquierdo selecciona el punto mas cercano (dentro de la
+// tolerancia) para mover o borrar, o agrega uno si no hay; el derecho mueve la vista
+void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+  double x,y; glfwGetCursorPos(window,&x,&y);
+  if (action==GLFW_RELEASE) {arrastrando=paneando=false; return;}
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureMouse) return;
+  if (button==GLFW_MOUSE_BUTTON_RIGHT){
+    paneando=true; xm_ant=x; ym_ant=y;
+    return;
+  }
+  if (button!=GLFW_MOUSE_BUTTON_LEFT) return;
+  p2e pm=a_mundo(x,y); pt=0; ipt=-1;
+  const p2e *s=V.mas_cercano(D,pm);
+  if (s&&pm.distanciac(*s)*escala<tol){
+    for (ipt=puntos.deep-1;ipt>=4;ipt--) if (&puntos[ipt]==s) break;
+    if (ipt>=4) pt=&puntos[ipt]; else ipt=-1;
+  }
+  if (!pt) {// agrega un punto
+    pt=new p2e(pm);
+    if (D.agregapunto(*pt)) {puntos.push(pt); ipt=puntos.deep-1; vis->punto(ipt,*pt);}
+    else {delete pt; pt=0;}
+  }
+  // pt es el punto a editar
+  arrastrando=(pt!=0);
+}
+
+// drag: mueve el punto seleccionado o la vista
+void mouseMoveCallback(GLFWwindow* window, double x, double y) {
+  if (paneando){
+    xv0-=(x-xm_ant)/escala; yv0-=(y-ym_ant)/escala;
+    xm_ant=x; ym_ant=y;
+    return;
+  }
+  if (!arrastrando) return;
+  p2e pm=a_mundo(x,y);
+  if (D.muevepunto(*pt,pm)) vis->punto(ipt,*pt);
+  else arrastrando=false;
+}
+
+// rueda: zoom dejando fijo el punto que esta bajo el cursor
+void scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+  if (Window::isImGuiEnabled(window) and ImGui::GetIO().WantCaptureMouse) return;
+  double x,y; glfwGetCursorPos(window,&x,&y);
+  double xw=xv0+x/escala, yw=yv0+y/escala;
+  escala=maximo(1e-3,minimo(escala*pow(1.2,yoffset),1e2));
+  xv0=xw-x/escala; yv0=yw-y/escala;
 }
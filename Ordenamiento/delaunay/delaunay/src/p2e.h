@@ -68,10 +68,11 @@ public:
     {return p2e(x+p.x,y+p.y);}
   p2e operator-(const p2e &p) const // resta
     {return p2e(x-p.x,y-p.y);}
+  // (en long long, en int desbordan con coordenadas de mas de 46340)
   long long operator%(const p2e &p) const // producto vectorial (% =precedencia *)
-    {return x*p.y-y*p.x;}
+    {return (long long)x*p.y-(long long)y*p.x;}
   long long operator*(const p2e &p) const // producto escalar
-    {return x*p.x+y*p.y;}
+    {return (long long)x*p.x+(long long)y*p.y;}
   p2e operator*(int t) const // escalar * p2e y viceversa
     {return p2e(t*x,t*y);}
   friend p2e operator*(int t,const p2e &p) {return (p*t);}
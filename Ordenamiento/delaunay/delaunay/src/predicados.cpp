@@ -0,0 +1,179 @@
+#include <cmath>
+#include "predicados.h"
+
+// epsilon de la maquina a la Shewchuk (la mitad del ulp de 1), para las cotas de error
+static const double EPS = std::ldexp(1.0,-53);
+static const double ERROR_ORIENT = (3.0+16.0*EPS)*EPS;
+static const double ERROR_INCIRCLE = (10.0+96.0*EPS)*EPS;
+// para partir un double en dos mitades de 26 bits (2^27+1)
+static const double SPLITTER = 134217729.0;
+
+// a+b = x+y exacto, con x=fl(a+b)
+static inline void sumaExacta(double a, double b, double &x, double &y) {
+  x = a+b;
+  double bv = x-a, av = x-bv;
+  y = (a-av)+(b-bv);
+}
+
+// idem, pero requiere |a|>=|b|
+static inline void sumaExactaRapida(double a, double b, double &x, double &y) {
+  x = a+b;
+  y = b-(x-a);
+}
+
+// a = hi+lo, cada mitad con a lo sumo 26 bits significativos
+static inline void partir(double a, double &hi, double &lo) {
+  double c = SPLITTER*a;
+  hi = c-(c-a);
+  lo = a-hi;
+}
+
+// a*b = x+y exacto, con x=fl(a*b) (b ya partido en bhi+blo)
+static inline void productoExacto(double a, double b, double bhi, double blo, double &x, double &y) {
+  x = a*b;
+  double ahi, alo;
+  partir(a,ahi,alo);
+  double err = x-ahi*bhi;
+  err -= alo*bhi;
+  err -= ahi*blo;
+  y = alo*blo-err;
+}
+
+static inline void productoExacto(double a, double b, double &x, double &y) {
+  double bhi, blo;
+  partir(b,bhi,blo);
+  productoExacto(a,b,bhi,blo,x,y);
+}
+
+// Las expansiones son arreglos de componentes de magnitud creciente que no se
+// solapan, cuya suma es el valor exacto; el ultimo componente tiene el signo
+// (y es una aproximacion) del total. Las funciones descartan los ceros y
+// devuelven la cantidad de componentes del resultado.
+
+// h = e+f (h debe tener lugar para ne+nf componentes)
+static int sumarExpansiones(int ne, const double *e, int nf, const double *f, double *h) {
+  int ie = 0, jf = 0, nh = 0;
+  // toma el componente que sigue en magnitud de cualquiera de las dos
+  auto siguiente = [&]() {
+    if (jf==nf or (ie<ne and std::fabs(e[ie])<std::fabs(f[jf]))) return e[ie++];
+    return f[jf++];
+  };
+  double q = siguiente(), hh;
+  while (ie<ne or jf<nf) {
+    sumaExacta(q,siguiente(),q,hh);
+    if (hh!=0.0) h[nh++] = hh;
+  }
+  if (q!=0.0 or nh==0) h[nh++] = q;
+  return nh;
+}
+
+// h = e*b (h debe tener lugar para 2*ne componentes)
+static int escalarExpansion(int ne, const double *e, double b, double *h) {
+  double bhi, blo, q, hh, p1, p0, s;
+  partir(b,bhi,blo);
+  productoExacto(e[0],b,bhi,blo,q,hh);
+  int nh = 0;
+  if (hh!=0.0) h[nh++] = hh;
+  for(int i=1;i<ne;++i) {
+    productoExacto(e[i],b,bhi,blo,p1,p0);
+    sumaExacta(q,p0,s,hh);
+    if (hh!=0.0) h[nh++] = hh;
+    sumaExactaRapida(p1,s,q,hh);
+    if (hh!=0.0) h[nh++] = hh;
+  }
+  if (q!=0.0 or nh==0) h[nh++] = q;
+  return nh;
+}
+
+// h = a*b-c*d exacto (hasta 4 componentes)
+static int restaProductos(double a, double b, double c, double d, double *h) {
+  double ab[2], cd[2];
+  productoExacto(a,b,ab[1],ab[0]);
+  productoExacto(c,d,cd[1],cd[0]);
+  cd[0] = -cd[0]; cd[1] = -cd[1];
+  return sumarExpansiones(2,ab,2,cd,h);
+}
+
+// determinante de orient2d desarrollado sobre las coordenadas originales (sin
+// restas previas, que podrian redondear), sumando los seis productos exactos
+static double orient2dExacto(double ax, double ay, double bx, double by, double cx, double cy) {
+  double ab[4], bc[4], ca[4], t8[8], det[12];
+  int nab = restaProductos(ax,by,bx,ay,ab);
+  int nbc = restaProductos(bx,cy,cx,by,bc);
+  int nca = restaProductos(cx,ay,ax,cy,ca);
+  int nt = sumarExpansiones(nab,ab,nbc,bc,t8);
+  int n = sumarExpansiones(nt,t8,nca,ca,det);
+  return det[n-1];
+}
+
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+  double izq = (ax-cx)*(by-cy), der = (ay-cy)*(bx-cx);
+  double det = izq-der;
+  double cota = ERROR_ORIENT*(std::fabs(izq)+std::fabs(der));
+  if (det>cota or -det>cota) return det;
+  return orient2dExacto(ax,ay,bx,by,cx,cy);
+}
+
+// (x^2+y^2)*e, con signo s (h debe tener lugar para 8*ne componentes)
+static int levantarExpansion(int ne, const double *e, double x, double y, double s, double *h) {
+  double t24[24], xx[48], yy[48];
+  int n = escalarExpansion(ne,e,x,t24);
+  int nxx = escalarExpansion(n,t24,s*x,xx);
+  n = escalarExpansion(ne,e,y,t24);
+  int nyy = escalarExpansion(n,t24,s*y,yy);
+  return sumarExpansiones(nxx,xx,nyy,yy,h);
+}
+
+// determinante de incircle sobre las coordenadas originales, como suma de los
+// cuatro menores de 3x3 (que salen de los seis productos cruzados) por el
+// cuadrado de la norma del punto que queda afuera de cada uno
+static double incircleExacto(double ax, double ay, double bx, double by,
+                              double cx, double cy, double dx, double dy)
+{
+  double ab[4], bc[4], cd[4], da[4], ac[4], bd[4];
+  int nab = restaProductos(ax,by,bx,ay,ab);
+  int nbc = restaProductos(bx,cy,cx,by,bc);
+  int ncd = restaProductos(cx,dy,dx,cy,cd);
+  int nda = restaProductos(dx,ay,ax,dy,da);
+  int nac = restaProductos(ax,cy,cx,ay,ac);
+  int nbd = restaProductos(bx,dy,dx,by,bd);
+
+  double t8[8], cda[12], dab[12], abc[12], bcd[12];
+  int nt = sumarExpansiones(ncd,cd,nda,da,t8);
+  int ncda = sumarExpansiones(nt,t8,nac,ac,cda);
+  nt = sumarExpansiones(nda,da,nab,ab,t8);
+  int ndab = sumarExpansiones(nt,t8,nbd,bd,dab);
+  for(int i=0;i<nac;++i) ac[i] = -ac[i];
+  for(int i=0;i<nbd;++i) bd[i] = -bd[i];
+  nt = sumarExpansiones(nab,ab,nbc,bc,t8);
+  int nabc = sumarExpansiones(nt,t8,nac,ac,abc);
+  nt = sumarExpansiones(nbc,bc,ncd,cd,t8);
+  int nbcd = sumarExpansiones(nt,t8,nbd,bd,bcd);
+
+  double adet[96], bdet[96], cdet[96], ddet[96], abdet[192], cddet[192], det[384];
+  int na = levantarExpansion(nbcd,bcd,ax,ay,+1.0,adet);
+  int nb = levantarExpansion(ncda,cda,bx,by,-1.0,bdet);
+  int nc = levantarExpansion(ndab,dab,cx,cy,+1.0,cdet);
+  int nd = levantarExpansion(nabc,abc,dx,dy,-1.0,ddet);
+  int nabd = sumarExpansiones(na,adet,nb,bdet,abdet);
+  int ncdd = sumarExpansiones(nc,cdet,nd,ddet,cddet);
+  int n = sumarExpansiones(nabd,abdet,ncdd,cddet,det);
+  return det[n-1];
+}
+
+double incircle(double ax, double ay, double bx, double by,
+                double cx, double cy, double dx, double dy)
+{
+  double adx = ax-dx, ady = ay-dy, bdx = bx-dx, bdy = by-dy, cdx = cx-dx, cdy = cy-dy;
+  double bdxcdy = bdx*cdy, cdxbdy = cdx*bdy, alift = adx*adx+ady*ady;
+  double cdxady = cdx*ady, adxcdy = adx*cdy, blift = bdx*bdx+bdy*bdy;
+  double adxbdy = adx*bdy, bdxady = bdx*ady, clift = cdx*cdx+cdy*cdy;
+  double det = alift*(bdxcdy-cdxbdy) + blift*(cdxady-adxcdy) + clift*(adxbdy-bdxady);
+  double permanente = (std::fabs(bdxcdy)+std::fabs(cdxbdy))*alift
+                  + (std::fabs(cdxady)+std::fabs(adxcdy))*blift
+                  + (std::fabs(adxbdy)+std::fabs(bdxady))*clift;
+  double cota = ERROR_INCIRCLE*permanente;
+  if (det>cota or -det>cota) return det;
+  return incircleExacto(ax,ay,bx,by,cx,cy,dx,dy);
+}
+
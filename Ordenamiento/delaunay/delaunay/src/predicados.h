@@ -0,0 +1,22 @@
+#ifndef _PREDICADOS_ // para no incluir dos veces
+#define _PREDICADOS_
+
+// Predicados geometricos adaptativos (como los de Shewchuk): primero se evaluan
+// en double y se acota el error de redondeo; solo si el resultado queda dentro
+// de esa cota (casos casi degenerados) se recalculan en aritmetica exacta, con
+// expansiones (sumas de doubles que no se solapan). El signo del resultado es
+// siempre exacto, el valor es una aproximacion del determinante.
+// (no compilar con -ffast-math ni contrayendo a*b+c en fma, porque las sumas y
+// productos exactos dependen del redondeo de cada operacion)
+
+// > 0 si a, b y c estan en sentido antihorario, < 0 si estan en sentido horario
+// y 0 si estan alineados (el valor es el doble del area con signo del triangulo)
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy);
+
+// > 0 si d esta dentro de la circunferencia que pasa por a, b y c (en sentido
+// antihorario), < 0 si esta afuera y 0 si los cuatro puntos son cocirculares
+double incircle(double ax, double ay, double bx, double by,
+                double cx, double cy, double dx, double dy);
+
+#endif
+
@@ -0,0 +1,2 @@
+#include "testsDelaunay.h"
+PruebaDelaunay probar_delaunay;
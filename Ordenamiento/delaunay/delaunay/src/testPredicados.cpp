@@ -0,0 +1,2 @@
+#include "testsPredicados.h"
+PruebaPredicados probar_predicados;
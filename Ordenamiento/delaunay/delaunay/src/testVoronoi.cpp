@@ -0,0 +1,2 @@
+#include "testsVoronoi.h"
+PruebaVoronoi probar_voronoi;
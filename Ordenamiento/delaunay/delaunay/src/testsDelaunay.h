@@ -0,0 +1,110 @@
+#ifndef _TESTSDELAUNAY_ // para no incluir dos veces
+#define _TESTSDELAUNAY_
+
+#include <cstdlib> // exit
+#include <iostream> // cerr
+#include <random>
+#include <vector>
+#include "delaunay.h"
+#include "testsPredicados.h" // esDelaunay
+
+#define del_assert(cond) if(!(cond)) {\
+  std::cerr << "Falla el caso de prueba del delaunay:\n   " << #cond << "\n";\
+  std::exit(1);\
+}
+
+// Pool de triangulos: vecinos por indice consistentes, enquetriangulo y
+// cluster sobre el pool, y que los triangulos que libera quitapunto se
+// reciclen (el pool no crece si se vuelven a agregar tantos puntos como se
+// quitaron); muevepunto corto (solo swaps) y largo (agrega y quita) dejando
+// Delaunay, rechazando destinos fuera del box o encima de otro punto, y
+// quitapunto hasta vaciarlo
+struct PruebaDelaunay{
+  // p esta dentro o en el borde del triangulo
+  static bool adentro(const Dtri &t, const p2e &p){
+    for (int k=0;k<3;k++){
+      const p2e &a=t[(k+1)%3], &b=t[(k+2)%3];
+      if (orient2d(a[0],a[1],b[0],b[1],p[0],p[1])<0) return false;
+    }
+    return true;
+  }
+
+  PruebaDelaunay(){
+    const int m=1000, n=300;
+    p2e b00(0,0),b10(m,0),b11(m,m),b01(0,m); // D guarda punteros
+    delaunay D(b00,b10,b11,b01);
+    del_assert(D.cantidad()==2 && PruebaPredicados::esDelaunay(D,2));
+
+    std::minstd_rand rng(7);
+    std::vector<p2e> pts; pts.reserve(2*n); // sin realocar
+    int agregados=0;
+    while (agregados<n){
+      pts.push_back(p2e(10+rng()%(m-20),10+rng()%(m-20)));
+      if (D.agregapunto(pts.back())) agregados++;
+      else pts.pop_back(); // muy cerca de otro
+    }
+    del_assert(PruebaPredicados::esDelaunay(D,2*n+2));
+
+    // enquetriangulo desde la grilla y desde cualquier triangulo
+    long long a[4];
+    for (int i=0;i<200;i++){
+      p2e q(1+rng()%(m-2),1+rng()%(m-2));
+      int t=D.enquetriangulo(q,a);
+      del_assert(!D[t].libre() && adentro(D[t],q));
+      int desde=rng()%D.tamanio();
+      while (D[desde].libre()) desde=(desde+1)%D.tamanio();
+      t=D.enquetriangulo(q,a,desde);
+      del_assert(!D[t].libre() && adentro(D[t],q));
+    }
+
+    // cluster: los triangulos alrededor de un punto, cada uno con el
+    // siguiente como vecino
+    std::vector<int> ct;
+    for (size_t i=0;i<pts.size();i+=17){
+      del_assert(D.cluster(pts[i],ct) && ct.size()>=3);
+      for (size_t k=0;k<ct.size();k++){
+        const Dtri &t=D[ct[k]];
+        del_assert(!t.libre() && t.indice(pts[i])!=3);
+        del_assert(t.indice_vecino(ct[(k+1)%ct.size()])!=3);
+      }
+    }
+
+    // quitar la mitad libera triangulos, y volver a agregar los reutiliza
+    const int tam=D.tamanio(), cambios=D.total_cambios();
+    for (int i=0;i<n/2;i++) del_assert(D.quitapunto(pts[i]));
+    del_assert(PruebaPredicados::esDelaunay(D,2*(n-n/2)+2));
+    del_assert(D.tamanio()==tam && D.total_cambios()>cambios);
+    for (int i=0;i<n/2;i++) del_assert(D.agregapunto(pts[i]));
+    del_assert(PruebaPredicados::esDelaunay(D,2*n+2));
+    del_assert(D.tamanio()==tam);
+    // un punto que no esta no se quita
+    p2e otro(m/2+1,m/2+3);
+    del_assert(!D.quitapunto(otro) && D.cantidad()==2*n+2);
+
+    // movimientos cortos (dentro de la estrella) y largos
+    for (int k=0;k<400;k++){
+      p2e &p=pts[rng()%pts.size()], antes(p);
+      p2e q= (k%2) ? p2e(p.x+int(rng()%21)-10,p.y+int(rng()%21)-10)
+                   : p2e(10+rng()%(m-20),10+rng()%(m-20));
+      if (D.muevepunto(p,q)) {del_assert(p.distanciac(q)<=1);} // (si cae en una arista se perturba)
+      else {del_assert(p==antes);}
+      del_assert(D.tamanio()<=tam+2); // el largo usa dos mas y los devuelve
+      if (k%20==0) del_assert(PruebaPredicados::esDelaunay(D,2*n+2));
+    }
+    del_assert(PruebaPredicados::esDelaunay(D,2*n+2));
+    // fuera del box, o encima de otro punto, no se mueve
+    p2e antes(pts[0]);
+    del_assert(!D.muevepunto(pts[0],p2e(m+5,m/2)) && pts[0]==antes);
+    del_assert(!D.muevepunto(pts[0],pts[1]) && pts[0]==antes);
+    del_assert(PruebaPredicados::esDelaunay(D,2*n+2));
+
+    // quitar todos (en otro orden que el de insercion)
+    for (int i=0;i<n;i++){
+      del_assert(D.quitapunto(pts[(i*7)%n]));
+      if (i%25==0) del_assert(PruebaPredicados::esDelaunay(D,2*(n-i-1)+2));
+    }
+    del_assert(PruebaPredicados::esDelaunay(D,2));
+  }
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef _TESTSPREDICADOS_ // para no incluir dos veces
+#define _TESTSPREDICADOS_
+
+#include <cstdlib> // exit
+#include <iostream> // cerr
+#include <vector>
+#include "delaunay.h"
+#include "predicados.h"
+
+#define pred_assert(cond) if(!(cond)) {\
+  std::cerr << "Falla el caso de prueba de predicados:\n   " << #cond << "\n";\
+  std::exit(1);\
+}
+
+// Predicados en el delaunay de enteros: tiene_c/contiene_c con coordenadas
+// donde la formula del centro (con long long) desbordaba, y una grilla (todos
+// los cuadrados con sus cuatro vertices cocirculares) que tiene que quedar
+// de Delaunay
+struct PruebaPredicados{
+  // todos los triangulos en uso con area positiva, vecinos reciprocos, ningun
+  // vertice opuesto estrictamente dentro del circulo y esperados triangulos
+  static bool esDelaunay(const delaunay &D, int esperados){
+    if (D.cantidad()!=esperados) return false;
+    int usados=0;
+    for (int i=0;i<D.tamanio();i++){
+      const Dtri &t=D[i];
+      if (t.libre()) continue;
+      usados++;
+      if (orient2d(t[0][0],t[0][1],t[1][0],t[1][1],t[2][0],t[2][1])<=0) return false;
+      for (int k=0;k<3;k++){
+        int v=t.vecino[k];
+        if (v<0) continue;
+        if (v>=D.tamanio()||D[v].libre()) return false;
+        int l=D[v].indice_vecino(i);
+        if (l==3) return false;
+        if (t.contiene_c(D[v][l])) return false;
+      }
+    }
+    return usados==esperados;
+  }
+
+  PruebaPredicados(){
+    // circunferencia de radio 2^20 (PT^2*aa ya no entra en un long long): el
+    // cuarto punto sobre ella, apenas afuera y apenas adentro
+    const int r=1<<20;
+    p2e a(r,0),b(0,r),c(-r,0);
+    Dtri t(a,b,c);
+    pred_assert(t.tiene_c(p2e(0,-r)) && !t.contiene_c(p2e(0,-r)));
+    pred_assert(!t.tiene_c(p2e(1,-r)));
+    pred_assert(t.contiene_c(p2e(0,1-r)));
+    pred_assert(t.contiene_c(p2e(0,0)) && !t.tiene_c(p2e(r,r)));
+
+    // grilla de 16x16 agregada en desorden (salto 7, coprimo con 256)
+    const int n=16, s=1<<12, m=n*s;
+    p2e b00(-m,-m),b10(2*m,-m),b11(2*m,2*m),b01(-m,2*m); // D guarda punteros
+    delaunay D(b00,b10,b11,b01);
+    std::vector<p2e> grilla; grilla.reserve(n*n); // sin realocar
+    for (int i=0,k=0;i<n*n;i++,k=(k+7)%(n*n))
+      grilla.push_back(p2e((k%n)*s,(k/n)*s));
+    for (size_t i=0;i<grilla.size();i++)
+      pred_assert(D.agregapunto(grilla[i]));
+    pred_assert(esDelaunay(D,2*n*n+2));
+  }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef _TESTSVORONOI_ // para no incluir dos veces
+#define _TESTSVORONOI_
+
+#include <algorithm> // min max
+#include <cmath> // fabs
+#include <cstdlib> // exit
+#include <iostream> // cerr
+#include <random>
+#include <vector>
+#include "delaunay.h"
+#include "voronoi.h"
+#include "predicados.h"
+
+#define vor_assert(cond) if(!(cond)) {\
+  std::cerr << "Falla el caso de prueba de voronoi:\n   " << #cond << "\n";\
+  std::exit(1);\
+}
+
+// Voronoi: que el actualizado de a poco (siguiendo el registro de cambios del
+// delaunay) coincida con uno armado de cero despues de agregar, mover y quitar
+// puntos, que haya una celda por sitio y que cada celda contenga a su sitio;
+// y que mas_cercano de el sitio mas cercano aunque el delaunay haya cambiado
+// desde el ultimo actualizar (como pasa en el visor al arrastrar un punto)
+struct PruebaVoronoi{
+  // las mismas celdas, con los mismos vertices (el poligono puede arrancar en
+  // otro lado)
+  static bool iguales(const Voronoi &A, const Voronoi &B){
+    if (A.celdas().size()!=B.celdas().size()) return false;
+    for (auto &c : A.celdas()){
+      const Voronoi::Celda *cb=B.celda(*c.first);
+      if (!cb) return false;
+      const std::vector<double> &pa=c.second.poligono, &pb=cb->poligono;
+      if (pa.size()!=pb.size()) return false;
+      for (size_t i=0;i<pa.size();i+=2){
+        bool esta=false;
+        for (size_t j=0;j<pb.size()&&!esta;j+=2)
+          esta=std::fabs(pa[i]-pb[j])<1e-6&&std::fabs(pa[i+1]-pb[j+1])<1e-6;
+        if (!esta) return false;
+      }
+    }
+    return true;
+  }
+  // el sitio esta dentro (o en el borde) del poligono de su celda
+  static bool contiene(const Voronoi::Celda &c, const p2e &s){
+    const std::vector<double> &p=c.poligono;
+    size_t n=p.size();
+    if (n<6) return false;
+    for (size_t i=0;i<n;i+=2){
+      size_t j=(i+2)%n;
+      if (orient2d(p[i],p[i+1],p[j],p[j+1],s[0],s[1])<-1e-6) return false;
+    }
+    return true;
+  }
+  // cuantos de los puntos estan en uso
+  static int activos(const std::vector<bool> &en_uso){
+    int n=0;
+    for (size_t i=0;i<en_uso.size();i++) if (en_uso[i]) n++;
+    return n;
+  }
+
+  // distancia^2 de q al punto en uso mas cercano (-1 si no hay ninguno)
+  static long long mas_cerca(const std::vector<p2e> &pts, const std::vector<bool> &en_uso, const p2e &q){
+    long long d=-1;
+    for (size_t i=0;i<pts.size();i++){
+      if (!en_uso[i]) continue;
+      long long di=q.distancia2(pts[i]);
+      if (d<0||di<d) d=di;
+    }
+    return d;
+  }
+
+  PruebaVoronoi(){
+    const int m=10000;
+    p2e b00(-m,-m),b10(2*m,-m),b11(2*m,2*m),b01(-m,2*m); // D guarda punteros
+    delaunay D(b00,b10,b11,b01);
+    Voronoi V;
+    V.actualizar(D);
+    vor_assert(V.celdas().empty()); // solo los virtuales
+
+    std::minstd_rand rng(11);
+    std::vector<p2e> pts; pts.reserve(400); // sin realocar
+    std::vector<bool> en_uso;
+    for (int ronda=0;ronda<8;ronda++){
+      // agrega
+      for (int i=0;i<40;i++){
+        pts.push_back(p2e(rng()%m,rng()%m));
+        en_uso.push_back(D.agregapunto(pts.back()));
+      }
+      V.actualizar(D);
+      // mueve (poco, y lejos) y quita algunos
+      for (int i=0;i<20;i++){
+        int k=rng()%pts.size();
+        if (!en_uso[k]) continue;
+        if (i%3==2) en_uso[k]=!D.quitapunto(pts[k]);
+        else if (i%3==1) D.muevepunto(pts[k],p2e(rng()%m,rng()%m));
+        else D.muevepunto(pts[k],p2e(pts[k].x+int(rng()%200)-100,pts[k].y+int(rng()%200)-100));
+      }
+      V.actualizar(D);
+      Voronoi W; W.actualizar(D);
+      vor_assert(iguales(V,W) && iguales(W,V));
+      vor_assert(int(V.celdas().size())==activos(en_uso));
+      for (size_t i=0;i<pts.size();i++){
+        if (!en_uso[i]) {vor_assert(!V.celda(pts[i])); continue;}
+        const Voronoi::Celda *c=V.celda(pts[i]);
+        vor_assert(c && contiene(*c,pts[i]));
+      }
+      vor_assert(!V.lineas(D).empty() && V.lineas(D).size()%4==0);
+    }
+
+    // mas_cercano con V desactualizado: se mueven y quitan puntos sin llamar a
+    // actualizar antes de cada consulta (q fuera del bounding box se lleva al borde)
+    for (int i=0;i<200;i++){
+      int k=rng()%pts.size();
+      if (en_uso[k]){
+        if (i%2) en_uso[k]=!D.quitapunto(pts[k]);
+        else D.muevepunto(pts[k],p2e(rng()%m,rng()%m));
+      }
+      p2e q(int(rng()%(5*m))-2*m,int(rng()%(5*m))-2*m);
+      const p2e *s=V.mas_cercano(D,q);
+      p2e qb(std::max(-m,std::min(2*m,q.x)),std::max(-m,std::min(2*m,q.y)));
+      vor_assert(s && qb.distancia2(*s)==mas_cerca(pts,en_uso,qb));
+    }
+    // sin puntos no hay ninguno
+    for (size_t i=0;i<pts.size();i++)
+      if (en_uso[i]) en_uso[i]=!D.quitapunto(pts[i]);
+    vor_assert(activos(en_uso)==0);
+    vor_assert(!V.mas_cercano(D,p2e(m/2,m/2)));
+  }
+};
+
+#endif
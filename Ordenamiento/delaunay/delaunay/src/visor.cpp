@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////
+//////////////////   VISOR DE DELAUNAY Y VORONOI   /////////////////////
+////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include "visor.h"
+#include "Debug.hpp"
+
+// lo que no hay que dibujar se manda lejos y lo descarta el clipping
+static const float afuera=-1e30f;
+static const int lados_circulo=64; // de la circunferencia unitaria que se instancia
+
+buffer_slots::buffer_slots(int floats_por_slot):por_slot(floats_por_slot),capacidad(0),todo(true){
+  glGenBuffers(1,&id);
+}
+
+buffer_slots::~buffer_slots(){
+  glDeleteBuffers(1,&id);
+}
+
+void buffer_slots::redimensiona(int n){
+  if (n>capacidad) todo=true; // se realoca en subir (con margen)
+  datos.resize(n*por_slot,0.f);
+}
+
+// Si hay que realocar sube todo; sino ordena los slots sucios y los junta en
+// tramos (se unen si los separan pocos slots) y manda un glBufferSubData por tramo
+void buffer_slots::subir(){
+  glBindBuffer(GL_ARRAY_BUFFER,id);
+  int n=slots();
+  if (todo){
+    if (n>capacidad) {
+      capacidad=std::max(n+n/2,1024);
+      glBufferData(GL_ARRAY_BUFFER,capacidad*por_slot*sizeof(float),nullptr,GL_DYNAMIC_DRAW);
+    }
+    if (n) glBufferSubData(GL_ARRAY_BUFFER,0,datos.size()*sizeof(float),datos.data());
+    todo=false; sucios.clear();
+    return;
+  }
+  if (sucios.empty()) return;
+  std::sort(sucios.begin(),sucios.end());
+  size_t i=0, m=sucios.size();
+  while (i<m){
+    int desde=sucios[i], hasta=desde;
+    while (++i<m && sucios[i]-hasta<=8) hasta=sucios[i];
+    if (desde>=n) break;
+    hasta=std::min(hasta,n-1);
+    glBufferSubData(GL_ARRAY_BUFFER,desde*por_slot*sizeof(float),
+                    (hasta-desde+1)*por_slot*sizeof(float),&datos[desde*por_slot]);
+  }
+  sucios.clear();
+}
+
+// arma un vao con un atributo vec2 desde el buffer dado
+static GLuint vao_vec2(const Shader &shader, GLuint vbo){
+  GLuint vao;
+  glGenVertexArrays(1,&vao);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER,vbo);
+  GLint loc=glGetAttribLocation(shader.getProgramId(),"vertexPosition");
+  cg_assert(loc!=-1,"Shader does not have vertexPosition attribute");
+  glVertexAttribPointer(loc,2,GL_FLOAT,GL_FALSE,0,0);
+  glEnableVertexAttribArray(loc);
+  return vao;
+}
+
+visor::visor():shader_lineas("shaders/delaunay"),
+               shader_circulos("shaders/circulos.vert","shaders/delaunay.frag"),
+               b_puntos(2),b_lineas(12),b_circulos(3),b_voronoi(12){
+  vao_puntos=vao_vec2(shader_lineas,b_puntos.vbo());
+  vao_lineas=vao_vec2(shader_lineas,b_lineas.vbo());
+  vao_voronoi=vao_vec2(shader_lineas,b_voronoi.vbo());
+
+  // circunferencias: la unitaria como geometria y centro+radio por instancia
+  std::vector<float> c(2*lados_circulo);
+  for (int i=0;i<lados_circulo;i++){
+    double a=2*3.14159265358979323846*i/lados_circulo;
+    c[2*i]=float(std::cos(a)); c[2*i+1]=float(std::sin(a));
+  }
+  glGenBuffers(1,&vbo_circulo);
+  glBindBuffer(GL_ARRAY_BUFFER,vbo_circulo);
+  glBufferData(GL_ARRAY_BUFFER,c.size()*sizeof(float),c.data(),GL_STATIC_DRAW);
+  vao_circulos=vao_vec2(shader_circulos,vbo_circulo);
+  glBindBuffer(GL_ARRAY_BUFFER,b_circulos.vbo());
+  GLint loc=glGetAttribLocation(shader_circulos.getProgramId(),"circulo");
+  cg_assert(loc!=-1,"Shader does not have circulo attribute");
+  glVertexAttribPointer(loc,3,GL_FLOAT,GL_FALSE,0,0);
+  glVertexAttribDivisor(loc,1);
+  glEnableVertexAttribArray(loc);
+  glBindVertexArray(0);
+}
+
+visor::~visor(){
+  GLuint vaos[4]={vao_puntos,vao_lineas,vao_voronoi,vao_circulos};
+  glDeleteVertexArrays(4,vaos);
+  glDeleteBuffers(1,&vbo_circulo);
+}
+
+void visor::puntos(const pila_ptr<p2e> &pts){
+  cantidad_puntos(pts.deep);
+  for (int i=0;i<pts.deep;i++) punto(i,pts[i]);
+}
+
+void visor::punto(int i, const p2e &p){
+  if (i>=npuntos) cantidad_puntos(i+1);
+  float *s=b_puntos.slot(i);
+  s[0]=float(p[0]); s[1]=float(p[1]);
+}
+
+void visor::cantidad_puntos(int n){
+  npuntos=n;
+  b_puntos.redimensiona(n);
+}
+
+// segmentos de los lados (cada uno lo dibuja el triangulo de mayor indice,
+// como las aristas de voronoi, salvo los que tocan un punto virtual),
+// circunferencia (centro y radio; radio<0 => no se dibuja) y aristas de voronoi
+void visor::escribir(const delaunay &D, const Voronoi &V, int it){
+  const Dtri &t=D[it];
+  float *l=b_lineas.slot(it), *c=b_circulos.slot(it), *v=b_voronoi.slot(it);
+  if (t.libre()){
+    std::fill(l,l+12,afuera); std::fill(v,v+12,afuera);
+    c[0]=c[1]=0; c[2]=-1;
+    return;
+  }
+  bool hay_virtual=false;
+  for (int k=0;k<3;k++){
+    const p2e &a=t[(k+1)%3], &b=t[(k+2)%3];
+    if (D.esvirtual(t[k])) hay_virtual=true;
+    if (t.vecino[k]>it||D.esvirtual(a)||D.esvirtual(b)) std::fill(l+4*k,l+4*k+4,afuera);
+    else {l[4*k]=a[0]; l[4*k+1]=a[1]; l[4*k+2]=b[0]; l[4*k+3]=b[1];}
+    if (!V.arista(D,it,k,v+4*k)) std::fill(v+4*k,v+4*k+4,afuera);
+  }
+  const double *cc=V.vertice(it);
+  c[0]=float(cc[0]); c[1]=float(cc[1]);
+  if (hay_virtual) c[2]=-1;
+  else {
+    double dx=cc[0]-t[0][0], dy=cc[1]-t[0][1];
+    c[2]=float(std::sqrt(dx*dx+dy*dy));
+  }
+}
+
+// Los triangulos del registro cambiaron, y sus vecinos pueden haber cambiado
+// de vecino (y con eso de quien dibuja la arista comun, o de adonde va la de
+// voronoi): se reescriben todos ellos. Si se perdio parte del registro se
+// reescribe todo.
+void visor::actualizar(const delaunay &D, Voronoi &V){
+  V.actualizar(D);
+  int it,n=D.tamanio();
+  if (n!=b_lineas.slots()){
+    b_lineas.redimensiona(n); b_circulos.redimensiona(n); b_voronoi.redimensiona(n);
+  }
+  if (leido<D.base_cambios()){
+    for (it=0;it<n;it++) escribir(D,V,it);
+  }
+  else {
+    const std::vector<int> &c=D.cambios();
+    revisar.clear();
+    for (size_t i=leido-D.base_cambios();i<c.size();i++){
+      it=c[i];
+      revisar.push_back(it);
+      const Dtri &t=D[it];
+      if (t.libre()) continue;
+      for (int k=0;k<3;k++) if (t.vecino[k]>=0) revisar.push_back(t.vecino[k]);
+    }
+    std::sort(revisar.begin(),revisar.end());
+    revisar.erase(std::unique(revisar.begin(),revisar.end()),revisar.end());
+    for (size_t i=0;i<revisar.size();i++) escribir(D,V,revisar[i]);
+  }
+  leido=D.total_cambios();
+}
+
+void visor::dibujar(const glm::mat4 &proyeccion, bool triangulos, bool circulos, bool voronoi){
+  b_puntos.subir(); b_lineas.subir(); b_circulos.subir(); b_voronoi.subir();
+  int n=b_lineas.slots();
+
+  shader_lineas.use();
+  shader_lineas.setUniform("projectionMatrix",proyeccion);
+  if (voronoi){
+    shader_lineas.setUniform("color",color_voronoi);
+    glBindVertexArray(vao_voronoi);
+    glDrawArrays(GL_LINES,0,6*n);
+  }
+  if (triangulos){
+    shader_lineas.setUniform("color",color_delaunay);
+    glBindVertexArray(vao_lineas);
+    glDrawArrays(GL_LINES,0,6*n);
+  }
+  if (circulos){
+    shader_circulos.use();
+    shader_circulos.setUniform("projectionMatrix",proyeccion);
+    shader_circulos.setUniform("color",color_circulo);
+    glBindVertexArray(vao_circulos);
+    glDrawArraysInstanced(GL_LINE_LOOP,0,lados_circulo,n);
+    shader_lineas.use();
+  }
+  glPointSize(tamanio_punto);
+  shader_lineas.setUniform("color",color_vertice);
+  glBindVertexArray(vao_puntos);
+  glDrawArrays(GL_POINTS,0,npuntos);
+  glBindVertexArray(0);
+}
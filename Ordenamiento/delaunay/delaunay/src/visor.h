@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////
+//////////////////   VISOR DE DELAUNAY Y VORONOI   /////////////////////
+////////////////////////////////////////////////////////////////////////
+
+#ifndef _VISOR_
+#define _VISOR_
+
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "Shaders.hpp"
+#include "utiles.h"
+#include "delaunay.h"
+#include "voronoi.h"
+
+// Buffer de floats en la gpu con una copia en memoria dividida en slots del
+// mismo tamanio (uno por punto o por triangulo del pool); se escriben los
+// slots que cambian y al subir se mandan solo esos (agrupados en tramos)
+class buffer_slots{
+  GLuint id;
+  int por_slot, capacidad; // floats por slot, slots alojados en la gpu
+  std::vector<float> datos;
+  std::vector<int> sucios;
+  bool todo; // hay que realocar o subir todo
+public:
+  buffer_slots(int floats_por_slot);
+  ~buffer_slots();
+  buffer_slots(const buffer_slots&) = delete;
+  buffer_slots &operator=(const buffer_slots&) = delete;
+
+  GLuint vbo() const {return id;}
+  int slots() const {return datos.size()/por_slot;}
+  // cambia la cantidad de slots (los nuevos quedan en 0)
+  void redimensiona(int n);
+  // para escribir el slot i (queda marcado para subir)
+  float *slot(int i) {sucios.push_back(i); return &datos[i*por_slot];}
+  // manda a la gpu lo que cambio
+  void subir();
+};
+
+// Dibuja puntos, triangulos, circunferencias y voronoi desde VBOs que se
+// conservan entre cuadros; despues de cada cambio en el delaunay solo se
+// reescriben los slots de los triangulos que aparecen en su registro de
+// cambios (y los de sus vecinos, porque cada arista la dibuja uno solo)
+class visor{
+public:
+  visor();
+  ~visor();
+  visor(const visor&) = delete;
+  visor &operator=(const visor&) = delete;
+
+  // puntos: todos, o el i-esimo despues de agregarlo o moverlo
+  void puntos(const pila_ptr<p2e> &pts);
+  void punto(int i, const p2e &p);
+  void cantidad_puntos(int n);
+
+  // se pone al dia con el delaunay (y actualiza V)
+  void actualizar(const delaunay &D, Voronoi &V);
+
+  void dibujar(const glm::mat4 &proyeccion, bool triangulos, bool circulos, bool voronoi);
+
+  glm::vec3 color_fondo = {0.95f,0.98f,1.f},
+            color_delaunay = {.2f,.2f,.6f},
+            color_voronoi = {.6f,.2f,.2f},
+            color_circulo = {.2f,.6f,.6f},
+            color_vertice = {.1f,.1f,.3f};
+  float tamanio_punto = 5;
+
+private:
+  Shader shader_lineas, shader_circulos;
+  GLuint vao_puntos=0, vao_lineas=0, vao_voronoi=0, vao_circulos=0, vbo_circulo=0;
+  buffer_slots b_puntos, b_lineas, b_circulos, b_voronoi;
+  int npuntos=0, leido=-1; // cambios del delaunay ya procesados
+  std::vector<int> revisar;
+
+  // reescribe los slots del triangulo it
+  void escribir(const delaunay &D, const Voronoi &V, int it);
+};
+
+#endif
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////
+//////////////////   DIAGRAMA DE VORONOI 2D   //////////////////////////
+////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "voronoi.h"
+
+// centro de la circunferencia del triangulo (en double, con origen en p0
+// para no perder precision; aa es el doble del producto vectorial, exacto)
+static void centro(const Dtri &t, double *c){
+  double ax=t[0][0], ay=t[0][1];
+  double bx=t[1][0]-ax, by=t[1][1]-ay, cx=t[2][0]-ax, cy=t[2][1]-ay;
+  if (!t.aa) {c[0]=ax+(bx+cx)/3; c[1]=ay+(by+cy)/3; return;} // degenerado => baricentro
+  double d=double(t.aa), b2=bx*bx+by*by, c2=cx*cx+cy*cy;
+  c[0]=ax+(cy*b2-by*c2)/d;
+  c[1]=ay+(bx*c2-cx*b2)/d;
+}
+
+// recorta un poligono convexo (x,y,...) al rectangulo ll-ur, con Sutherland-Hodgman
+// (una pasada por cada lado del rectangulo)
+static void recortar(std::vector<double> &pol, const double *ll, const double *ur){
+  std::vector<double> out;
+  for (int lado=0;lado<4;lado++){
+    int eje=lado/2;
+    double lim=(lado&1)? ur[eje]: ll[eje], s=(lado&1)? -1: 1; // s*(x-lim)>=0 es adentro
+    int n=pol.size()/2;
+    out.clear();
+    for (int i=0;i<n;i++){
+      const double *a=&pol[2*i], *b=&pol[2*((i+1)%n)];
+      double da=s*(a[eje]-lim), db=s*(b[eje]-lim);
+      if (da>=0) {out.push_back(a[0]); out.push_back(a[1]);}
+      if ((da>=0)!=(db>=0)) { // cruza el lado
+        double f=da/(da-db);
+        out.push_back(a[0]+f*(b[0]-a[0])); out.push_back(a[1]+f*(b[1]-a[1]));
+      }
+    }
+    pol.swap(out);
+  }
+}
+
+// recorta el segmento a-b al rectangulo ll-ur (Liang-Barsky); false si queda afuera
+static bool recortar(double *a, double *b, const double *ll, const double *ur){
+  double t0=0, t1=1, d[2]={b[0]-a[0],b[1]-a[1]};
+  for (int lado=0;lado<4;lado++){
+    int eje=lado/2;
+    double p=(lado&1)? d[eje]: -d[eje], q=(lado&1)? ur[eje]-a[eje]: a[eje]-ll[eje];
+    if (p==0) {if (q<0) return false; continue;} // paralelo a ese lado
+    double r=q/p;
+    if (p<0) {if (r>t1) return false; if (r>t0) t0=r;}
+    else {if (r<t0) return false; if (r<t1) t1=r;}
+  }
+  double a0[2]={a[0],a[1]};
+  a[0]=a0[0]+t0*d[0]; a[1]=a0[1]+t0*d[1];
+  b[0]=a0[0]+t1*d[0]; b[1]=a0[1]+t1*d[1];
+  return true;
+}
+
+// si q esta dentro (o en el borde) del poligono convexo antihorario
+static bool dentro(const std::vector<double> &pol, const p2e &q){
+  int n=pol.size()/2;
+  if (n<3) return false;
+  for (int i=0;i<n;i++){
+    const double *a=&pol[2*i], *b=&pol[2*((i+1)%n)];
+    if ((b[0]-a[0])*(q[1]-a[1])-(b[1]-a[1])*(q[0]-a[0])<0) return false;
+  }
+  return true;
+}
+
+void Voronoi::tomar_triangulo(const delaunay &D, int it){
+  const Dtri &t=D[it];
+  centro(t,&vertices[2*it]);
+  sitios[3*it]=t.p[0]; sitios[3*it+1]=t.p[1]; sitios[3*it+2]=t.p[2];
+}
+
+// recorre los triangulos alrededor del sitio como delaunay::cluster (pasando
+// al vecino por la arista que sigue en sentido antihorario) juntando los centros
+void Voronoi::armar_celda(const delaunay &D, int it, int ix){
+  const p2e *s=D[it].p[ix];
+  Celda &c=m_celdas[s];
+  c.tris.clear(); c.poligono.clear();
+  int t=it;
+  do {
+    c.tris.push_back(t);
+    c.poligono.push_back(vertices[2*t]); c.poligono.push_back(vertices[2*t+1]);
+    t=D[t].vecino[(ix+1)%3];
+    if (t<0) break; // esta en la frontera (solo pasa con los virtuales)
+    ix=D[t].indice(*s);
+  } while (t!=it);
+  double ll[2]={double(D.ll[0]),double(D.ll[1])}, ur[2]={double(D.ur[0]),double(D.ur[1])};
+  recortar(c.poligono,ll,ur);
+}
+
+// una pasada por los triangulos para los vertices y otra para las celdas
+// (cada celda recorre los triangulos de su sitio, asi que en total es lineal)
+void Voronoi::construir(const delaunay &D){
+  int it,k,n=D.tamanio();
+  vertices.assign(2*n,0.); sitios.assign(3*n,(const p2e*)0);
+  m_celdas.clear(); m_celdas.reserve(n/2+1);
+  for (it=0;it<n;it++) if (!D[it].libre()) tomar_triangulo(D,it);
+  for (it=0;it<n;it++){
+    const Dtri &t=D[it];
+    if (t.libre()) continue;
+    for (k=0;k<3;k++)
+      if (!D.esvirtual(t[k])&&!m_celdas.count(t.p[k])) armar_celda(D,it,k);
+  }
+  leido=D.total_cambios(); lineas_ok=false;
+}
+
+// Los sitios que tenia o tiene cada triangulo cambiado quedan sucios y se
+// borran sus celdas; despues se rearman a partir de los triangulos cambiados
+// que siguen en uso (todo sitio que sigue en la triangulacion aparece en alguno
+// de ellos; los que no aparecen son puntos que se quitaron)
+void Voronoi::actualizar(const delaunay &D){
+  if (leido<D.base_cambios()) {construir(D); return;}
+  const std::vector<int> &c=D.cambios();
+  int i,k,desde=leido-D.base_cambios(), hasta=c.size();
+  if (desde==hasta) return;
+  int n=D.tamanio();
+  if (int(vertices.size())<2*n) {vertices.resize(2*n,0.); sitios.resize(3*n,(const p2e*)0);}
+  std::vector<const p2e*> sucios;
+  std::vector<int> tris;
+  for (i=desde;i<hasta;i++){
+    int it=c[i];
+    for (k=0;k<3;k++) if (sitios[3*it+k]) sucios.push_back(sitios[3*it+k]);
+    if (D[it].libre()) {sitios[3*it]=sitios[3*it+1]=sitios[3*it+2]=0;}
+    else {tomar_triangulo(D,it); tris.push_back(it);}
+  }
+  // (los punteros sucios pueden ser de puntos ya borrados, solo se usan como clave)
+  for (i=0;i<int(sucios.size());i++) m_celdas.erase(sucios[i]);
+  for (i=0;i<int(tris.size());i++){
+    const Dtri &t=D[tris[i]];
+    if (t.libre()) continue;
+    for (k=0;k<3;k++)
+      if (!D.esvirtual(t[k])&&!m_celdas.count(t.p[k])) armar_celda(D,tris[i],k);
+  }
+  leido=D.total_cambios(); lineas_ok=false;
+}
+
+const Voronoi::Celda *Voronoi::celda(const p2e &sitio) const{
+  std::unordered_map<const p2e*,Celda>::const_iterator i=m_celdas.find(&sitio);
+  return (i==m_celdas.end())? 0: &(i->second);
+}
+
+// Camina por el grafo de Delaunay desde el vertice (real) mas cercano del
+// triangulo que contiene a q, pasando al vecino mas cercano mientras mejore; si
+// al final q no cae en la celda del sitio (el camino se trabo junto a los
+// puntos virtuales) lo busca entre todas las celdas
+const p2e *Voronoi::mas_cercano(const delaunay &D, p2e q){
+  actualizar(D); // si no, las celdas pueden ser de puntos ya quitados
+  if (m_celdas.empty()) return 0;
+  q[0]=maximo(D.ll[0],minimo(D.ur[0],q[0]));
+  q[1]=maximo(D.ll[1],minimo(D.ur[1],q[1]));
+  long long a[4], d=0, dv;
+  const Dtri &t=D[D.enquetriangulo(q,a)];
+  const p2e *s=0;
+  for (int k=0;k<3;k++){
+    if (D.esvirtual(t[k])) continue;
+    dv=q.distancia2(t[k]);
+    if (!s||dv<d) {s=t.p[k]; d=dv;}
+  }
+  if (s){
+    const Celda *c=celda(*s);
+    bool mejoro=true;
+    while (mejoro&&c){
+      mejoro=false;
+      const p2e &actual=*s; // s puede cambiar en el medio de la vuelta
+      for (size_t i=0;i<c->tris.size();i++){
+        const Dtri &tv=D[c->tris[i]];
+        const p2e &v=tv[(tv.indice(actual)+1)%3];
+        if (D.esvirtual(v)) continue;
+        dv=q.distancia2(v);
+        if (dv<d) {s=&v; d=dv; mejoro=true;}
+      }
+      if (mejoro) c=celda(*s);
+    }
+    if (c&&dentro(c->poligono,q)) return s;
+  }
+  s=0;
+  std::unordered_map<const p2e*,Celda>::const_iterator i;
+  for (i=m_celdas.begin();i!=m_celdas.end();++i){
+    dv=q.distancia2(*(i->first));
+    if (!s||dv<d) {s=i->first; d=dv;}
+  }
+  return s;
+}
+
+// La arista del lado k del triangulo it la arma el de mayor indice de los dos
+// vecinos; en la frontera es una semirecta perpendicular hacia afuera; no se
+// incluyen las que separan dos puntos virtuales
+bool Voronoi::arista(const delaunay &D, int it, int k, float *seg) const{
+  const Dtri &t=D[it];
+  int v=t.vecino[k];
+  if (t.libre()||v>it) return false;
+  const p2e &a=t[(k+1)%3], &b=t[(k+2)%3];
+  if (D.esvirtual(a)&&D.esvirtual(b)) return false;
+  double ll[2]={double(D.ll[0]),double(D.ll[1])}, ur[2]={double(D.ur[0]),double(D.ur[1])};
+  double p0[2]={vertices[2*it],vertices[2*it+1]}, p1[2];
+  if (v>=0) {p1[0]=vertices[2*v]; p1[1]=vertices[2*v+1];}
+  else {
+    double largo=2*((ur[0]-ll[0])+(ur[1]-ll[1])); // para que la semirecta salga del bbox
+    double dx=b[0]-a[0], dy=b[1]-a[1], l=std::sqrt(dx*dx+dy*dy);
+    if (l==0) return false;
+    p1[0]=p0[0]+dy*largo/l; p1[1]=p0[1]-dx*largo/l;
+  }
+  if (!recortar(p0,p1,ll,ur)) return false;
+  seg[0]=float(p0[0]); seg[1]=float(p0[1]); seg[2]=float(p1[0]); seg[3]=float(p1[1]);
+  return true;
+}
+
+const std::vector<float> &Voronoi::lineas(const delaunay &D){
+  actualizar(D);
+  if (lineas_ok) return m_lineas;
+  m_lineas.clear();
+  float seg[4];
+  int n=D.tamanio();
+  for (int it=0;it<n;it++){
+    for (int k=0;k<3;k++)
+      if (arista(D,it,k,seg)) m_lineas.insert(m_lineas.end(),seg,seg+4);
+  }
+  lineas_ok=true;
+  return m_lineas;
+}
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////
+//////////////////   DIAGRAMA DE VORONOI 2D   //////////////////////////
+////////////////////////////////////////////////////////////////////////
+
+#ifndef _VORONOI_
+#define _VORONOI_
+
+#include <vector>
+#include <unordered_map>
+#include "delaunay.h"
+
+// Diagrama de Voronoi de los puntos de un delaunay (sin los 4 virtuales del
+// bounding box): los vertices son los centros de las circunferencias de los
+// triangulos y la celda de cada sitio es el poligono de los centros de los
+// triangulos que lo tienen, en orden, recortado al bounding box.
+// Se arma en una pasada por los triangulos y despues se actualiza solo lo que
+// cambio, siguiendo el registro de cambios del delaunay.
+class Voronoi{
+public:
+  struct Celda{
+    std::vector<int> tris;        // triangulos alrededor del sitio (antihorario)
+    std::vector<double> poligono; // x0,y0,x1,y1,... (antihorario, recortado)
+  };
+
+  Voronoi():leido(-1),lineas_ok(false){}
+
+  // se pone al dia con el delaunay (la primera vez, o si se descarto parte del
+  // registro de cambios que no leyo, lo arma de nuevo)
+  void actualizar(const delaunay &D);
+
+  // vertice de voronoi del triangulo it (centro de su circunferencia, x,y)
+  const double *vertice(int it) const {return &vertices[2*it];}
+
+  // celda de un sitio (0 si no hay, por ej. para los puntos virtuales)
+  const Celda *celda(const p2e &sitio) const;
+  const std::unordered_map<const p2e*,Celda> &celdas() const {return m_celdas;}
+
+  // sitio mas cercano a q (0 si no hay ninguno), q se lleva al bounding box;
+  // antes se pone al dia con D, que puede haber cambiado desde el ultimo dibujo
+  const p2e *mas_cercano(const delaunay &D, p2e q);
+
+  // arista de voronoi que cruza el lado k del triangulo it, recortada al
+  // bounding box (x0,y0,x1,y1); false si no la tiene o si la arma el vecino
+  bool arista(const delaunay &D, int it, int k, float *seg) const;
+
+  // aristas recortadas al bounding box, como pares de puntos (x,y) para
+  // dibujar con GL_LINES; se regeneran solo si algo cambio
+  const std::vector<float> &lineas(const delaunay &D);
+
+private:
+  int leido; // cambios del delaunay ya procesados (-1 => nunca se armo)
+  std::vector<double> vertices; // 2 por triangulo del pool
+  std::vector<const p2e*> sitios; // 3 por triangulo: sus puntos al ultimo actualizar
+  std::unordered_map<const p2e*,Celda> m_celdas;
+  std::vector<float> m_lineas;
+  bool lineas_ok;
+
+  void construir(const delaunay &D);
+  // recalcula el vertice del triangulo it y guarda sus sitios
+  void tomar_triangulo(const delaunay &D, int it);
+  // arma la celda del sitio que esta en el lugar ix del triangulo it
+  void armar_celda(const delaunay &D, int it, int ix);
+};
+
+#endif
@@ -0,0 +1,51 @@
+#version 330 core
+
+// evalua un parche bicubico de Bezier por instancia, los 16 puntos de control
+// de cada parche estan consecutivos en patchData; no usa atributos de vertice
+
+uniform samplerBuffer patchData;
+uniform int gridSize; // cantidad de puntos por lado del parche
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+uniform vec4 lightPosition;
+
+out vec3 fragPosition;
+out vec3 fragNormal;
+out vec4 lightVSPosition;
+out float colorDecay;
+
+void bernstein(float t, out vec4 b, out vec4 d) {
+	float s = 1.f-t;
+	b = vec4(s*s*s, 3.f*t*s*s, 3.f*t*t*s, t*t*t);
+	d = vec4(-3.f*s*s, 3.f*s*s-6.f*t*s, 6.f*t*s-3.f*t*t, 3.f*t*t);
+}
+
+void main() {
+	float u = float(gl_VertexID%gridSize)/float(gridSize-1);
+	float v = float(gl_VertexID/gridSize)/float(gridSize-1);
+	vec4 bu, du, bv, dv;
+	bernstein(u,bu,du);
+	bernstein(v,bv,dv);
+	
+	vec3 p = vec3(0.f), pu = vec3(0.f), pv = vec3(0.f);
+	int base = gl_InstanceID*16;
+	for(int j=0;j<4;++j) {
+		for(int i=0;i<4;++i) {
+			vec3 cp = texelFetch(patchData,base+j*4+i).xyz;
+			p  += (bv[j]*bu[i])*cp;
+			pu += (bv[j]*du[i])*cp;
+			pv += (dv[j]*bu[i])*cp;
+		}
+	}
+	vec3 vertexNormal = cross(pu,pv);
+	
+	mat4 viewModelMatrix = viewMatrix * modelMatrix;
+	vec4 vmPos = viewModelMatrix * vec4(p,1.f);
+	gl_Position = projectionMatrix * vmPos;
+	fragPosition = vec3(vmPos);
+	fragNormal = mat3(transpose(inverse(viewModelMatrix))) * vertexNormal;
+	lightVSPosition = viewMatrix * lightPosition;
+	colorDecay = fragNormal.z<0.f ? .5f : 1.f;
+}
@@ -1,30 +1,9 @@
-#include <iostream>
-#include <fstream>
+#include <random>
 #include "SubDivMesh.hpp"
 #include "Debug.hpp"
 
 SubDivMesh::SubDivMesh(const std::string &fname) {
-	e.clear(); n.clear();
-	std::ifstream f(fname);
-	if (!f.is_open()) return;
-	int nv;
-	f>>nv;
-	float x,y,z;
-	for (int i=0;i<nv;i++) {
-		f>>x>>y>>z;
-		n.push_back(Nodo({x,y,z}));
-	}
-	int ne;
-	f>>ne;
-	int v0,v1,v2,v3;
-	for (int i=0;i<ne;i++) {
-		f>>nv>>v0>>v1>>v2;
-		if (nv==3) { agregarElemento(v0,v1,v2); }
-		else { f>>v3; agregarElemento(v0,v1,v2,v3); }
-	}
-	f.close();
-	makeVecinos();
-	
+	load(fname);
 }
 
 void SubDivMesh::agregarElemento(int n0, int n1, int n2, int n3) {
@@ -89,25 +68,99 @@ void SubDivMesh::makeVecinos() {
 	}
 }
 
-void SubDivMesh::verificarIntegridad() const {
-	int esz = e.size(), nsz = n.size();
-	// ver para cada nodo de un elemento, quu el nodo tenga la ref al elemento en su e
-	for (int ie=0; ie<esz; ++ie) { 
-		const Elemento &ei = e[ie];
+// Rearma las listas de elementos de cada nodo en tiempo lineal, contando primero
+// para reservar justo lo necesario (para cuando se reemplazan todos los elementos juntos)
+void SubDivMesh::makeElementosDeNodos() {
+	int nsz = n.size();
+	std::vector<int> cant(nsz,0);
+	for (const Elemento &ei : e) {
 		for (int in : ei) {
-			cg_assert(in>=0 and in<nsz,"El elemento ie tiene un indice de vertice no valido");
-			auto &enj = n[in].e;
-			cg_assert(std::find(enj.begin(),enj.end(),ie)!=enj.end(),"El nodo in no tiene en su .e al elemento ie");
+			cg_assert(in>=0 and in<nsz,"El elemento tiene un indice de nodo no valido");
+			++cant[in];
 		}
 	}
+	for (int i=0;i<nsz;i++) { n[i].e.clear(); n[i].e.reserve(cant[i]); }
+	for (int ie=0;ie<static_cast<int>(e.size());ie++)
+		for (int in : e[ie]) n[in].e.push_back(ie);
+}
+
+// Busca los (hasta 2) nodos unidos a in por aristas de frontera, retorna cuantos encontro
+// (requiere que esten actualizados los vecinos, ver makeVecinos)
+int SubDivMesh::vecinosFrontera(int in, int vec[2]) const {
+	int nvec = 0;
+	for (int ie : n[in].e) {
+		const Elemento &ei = e[ie];
+		int j = ei.Indice(in);
+		if (ei.v[j]<0 and nvec<2) vec[nvec++] = ei[j+1];
+		if (ei.v[(j+ei.nv-1)%ei.nv]<0 and nvec<2) vec[nvec++] = ei[j-1];
+	}
+	return nvec;
+}
+
+// Verificacion completa: arma (en orden de elemento, o sea ya ordenadas) las listas
+// de elementos de cada nodo segun los .n de los elementos, y las compara con las .e
+// de los nodos ordenadas; es lineal (salvo el sort de cada .e, que son cortas) y
+// cada nodo se verifica en paralelo
+static void verificarCompleta(const SubDivMesh &m) {
+	int esz = m.e.size(), nsz = m.n.size();
+	std::vector<int> inicio(nsz+1,0);
+	for (int ie=0; ie<esz; ++ie) {
+		for (int in : m.e[ie]) {
+			cg_assert(in>=0 and in<nsz,"El elemento "<<ie<<" tiene un indice de vertice no valido");
+			++inicio[in+1];
+		}
+	}
+	for (int in=0; in<nsz; ++in) inicio[in+1] += inicio[in];
+	std::vector<int> lista(inicio[nsz]), pos(inicio.begin(),inicio.end()-1);
+	for (int ie=0; ie<esz; ++ie)
+		for (int in : m.e[ie]) lista[pos[in]++] = ie;
 	
-	// ver que cada elemento al que un nodo dice pertenecer, efectivamente lo contenga
-	for (int in=0; in<nsz; ++in) {
-		const Nodo &ni = n[in];
-		for (int ie : ni.e) {
-			cg_assert(ie>=0 and ie<esz,"El nodo in tiene un indice de elemento no valido");
-			cg_assert(e[ie].Tiene(in),"El elemento ie no tiene al nodo in entre en su .n");
+	int nodo_malo = nsz; // el menor nodo con error (para que el mensaje no dependa de los hilos)
+	#pragma omp parallel
+	{
+		std::vector<int> ord;
+		#pragma omp for
+		for (int in=0; in<nsz; ++in) {
+			const std::vector<int> &ni_e = m.n[in].e;
+			bool ok = static_cast<int>(ni_e.size())==inicio[in+1]-inicio[in];
+			if (ok) {
+				ord.assign(ni_e.begin(),ni_e.end());
+				std::sort(ord.begin(),ord.end());
+				ok = std::equal(ord.begin(),ord.end(),lista.begin()+inicio[in]);
+			}
+			if (not ok) {
+				#pragma omp critical
+				nodo_malo = std::min(nodo_malo,in);
+			}
+		}
+	}
+	cg_assert(nodo_malo==nsz,"La lista .e del nodo "<<nodo_malo<<" no coincide con los elementos que lo tienen en su .n");
+}
+
+// Verificacion por muestreo: solo mira algunos nodos y algunos elementos al azar
+static void verificarMuestra(const SubDivMesh &m, int muestras) {
+	static std::minstd_rand rng;
+	int esz = m.e.size(), nsz = m.n.size();
+	for (int k=0; k<muestras and esz>0; ++k) {
+		// ver que los nodos del elemento tengan la ref al elemento en su .e
+		int ie = rng()%esz;
+		for (int in : m.e[ie]) {
+			cg_assert(in>=0 and in<nsz,"El elemento "<<ie<<" tiene un indice de vertice no valido");
+			auto &enj = m.n[in].e;
+			cg_assert(std::find(enj.begin(),enj.end(),ie)!=enj.end(),"El nodo "<<in<<" no tiene en su .e al elemento "<<ie);
+		}
+	}
+	for (int k=0; k<muestras and nsz>0; ++k) {
+		// ver que cada elemento al que el nodo dice pertenecer, efectivamente lo contenga
+		int in = rng()%nsz;
+		for (int ie : m.n[in].e) {
+			cg_assert(ie>=0 and ie<esz,"El nodo "<<in<<" tiene un indice de elemento no valido");
+			cg_assert(m.e[ie].Tiene(in),"El elemento "<<ie<<" no tiene al nodo "<<in<<" entre en su .n");
 		}
 	}
 }
 
+void SubDivMesh::verificarIntegridad(int muestras) const {
+	if (muestras>0) verificarMuestra(*this,muestras);
+	else verificarCompleta(*this);
+}
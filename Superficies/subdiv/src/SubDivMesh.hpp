@@ -6,6 +6,7 @@
 #include <vector>
 #include <cmath>
 #include <memory>
+#include <string>
 #include <glm/glm.hpp>
 
 // Nodo o vrtice: punto mas datos para usar en una malla
@@ -51,6 +52,14 @@ struct Elemento {
 	const int *end() const { return n+nv; }
 };
 
+// En release la verificacion de integridad que se hace al final de cada
+// subdivision es solo por muestreo (la completa se puede pedir explicitamente)
+#ifdef NDEBUG
+#	define SUBDIV_MUESTRAS_INTEGRIDAD 256
+#else
+#	define SUBDIV_MUESTRAS_INTEGRIDAD 0
+#endif
+
 // Malla guarda principalmente una lista de nodos y elementos
 struct SubDivMesh {
 	std::vector<Nodo> n;
@@ -58,11 +67,19 @@ struct SubDivMesh {
 	
 	SubDivMesh() = default;
 	SubDivMesh(const std::string &fname);
+	bool load(const std::string &fname); // .dat (texto) o .sdm (binario, con vecinos)
+	bool save(const std::string &fname) const; // siempre en formato .sdm
 	void makeVecinos();
 	void agregarElemento(int n0, int n1, int n2, int n3=-1);
 	void reemplazarElemento(int ie, int n0, int n1, int n2, int n3=-1);
+	void makeElementosDeNodos(); // rearma las listas .e de los nodos a partir de los elementos
+	int vecinosFrontera(int in, int vec[2]) const; // nodos vecinos de in por aristas de frontera
 	
-	void verificarIntegridad() const;
+	// con muestras>0 solo verifica esa cantidad de nodos y elementos elegidos al azar
+	void verificarIntegridad(int muestras=SUBDIV_MUESTRAS_INTEGRIDAD) const;
+private:
+	bool loadDat(const std::string &fname);
+	bool loadSdm(const std::string &fname);
 };
 
 #endif
@@ -0,0 +1,144 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include "SubDivMesh.hpp"
+#include "Debug.hpp"
+
+// Formato binario .sdm:
+//   cabecera: "SDM1", cantidad de nodos (int32), cantidad de elementos (int32)
+//   posiciones de los nodos (3 floats por nodo)
+//   marcas de frontera de los nodos (1 byte por nodo)
+//   elementos tal cual estan en memoria (nv, n[4], v[4]: 9 int32 por elemento)
+// Se guardan los vecinos para no tener que llamar a makeVecinos al cargar.
+// Las listas .e de los nodos no se guardan, se reconstruyen en tiempo lineal.
+
+static const char sdm_magic[4] = { 'S','D','M','1' };
+
+static_assert(sizeof(glm::vec3)==3*sizeof(float),"glm::vec3 no es compacto");
+static_assert(sizeof(Elemento)==9*sizeof(int),"Elemento tiene relleno");
+
+static bool endsWith(const std::string &str, const char *suffix) {
+	size_t l = std::strlen(suffix);
+	return str.size()>=l and str.compare(str.size()-l,l,suffix)==0;
+}
+
+// lee el archivo completo de una vez, para no parsear desde el stream token a token
+static bool readFile(const std::string &fname, std::string &data) {
+	std::ifstream f(fname,std::ios::binary);
+	if (!f.is_open()) return false;
+	f.seekg(0,std::ios::end);
+	std::streamoff tam = f.tellg();
+	// tellg da -1 si no se puede posicionar (un pipe), y algo enorme para un directorio
+	if (tam<0 or static_cast<unsigned long long>(tam)>=data.max_size()) return false;
+	data.resize(static_cast<size_t>(tam));
+	f.seekg(0,std::ios::beg);
+	f.read(&data[0],data.size());
+	return static_cast<bool>(f);
+}
+
+// se carga en una malla auxiliar, asi si el archivo no se puede leer o esta
+// mal formado la actual queda como estaba
+bool SubDivMesh::load(const std::string &fname) {
+	SubDivMesh aux;
+	if (not (endsWith(fname,".sdm") ? aux.loadSdm(fname) : aux.loadDat(fname))) return false;
+	std::swap(n,aux.n); std::swap(e,aux.e);
+	return true;
+}
+
+bool SubDivMesh::loadDat(const std::string &fname) {
+	std::string data;
+	if (not readFile(fname,data)) return false;
+	const char *p = data.c_str();
+	char *next;
+	bool ok = true; // si algun numero no se pudo leer (strtol/strtof no avanzan)
+	auto readInt = [&]() { int i = std::strtol(p,&next,10); ok = ok and next!=p; p = next; return i; };
+	auto readFloat = [&]() { float x = std::strtof(p,&next); ok = ok and next!=p; p = next; return x; };
+
+	int nv = readInt();
+	if (not ok or nv<0) return false;
+	n.reserve(std::min<size_t>(nv,data.size()));
+	for (int i=0;i<nv;i++) {
+		float x = readFloat(), y = readFloat(), z = readFloat();
+		if (not ok) return false;
+		n.push_back(Nodo({x,y,z}));
+	}
+	int ne = readInt();
+	if (not ok or ne<0) return false;
+	e.reserve(std::min<size_t>(ne,data.size()));
+	for (int i=0;i<ne;i++) {
+		int cant = readInt();
+		if (cant!=3 and cant!=4) return false;
+		int v[4] = { readInt(), readInt(), readInt(), cant==4 ? readInt() : -1 };
+		if (not ok) return false;
+		for (int j=0;j<cant;j++) {
+			if (v[j]<0 or v[j]>=nv) return false;
+			for (int k=0;k<j;k++) 
+				if (v[k]==v[j]) return false;
+		}
+		agregarElemento(v[0],v[1],v[2],v[3]);
+	}
+	makeVecinos();
+	return true;
+}
+
+bool SubDivMesh::loadSdm(const std::string &fname) {
+	std::ifstream f(fname,std::ios::binary);
+	if (!f.is_open()) return false;
+	char magic[4]; int nn=0, ne=0;
+	f.read(magic,4);
+	f.read(reinterpret_cast<char*>(&nn),sizeof(int));
+	f.read(reinterpret_cast<char*>(&ne),sizeof(int));
+	if ((not f) or std::memcmp(magic,sdm_magic,4)!=0 or nn<0 or ne<0) return false;
+	// que las cantidades de la cabecera coincidan con el tamanio del archivo
+	// (antes de reservar memoria para ellas)
+	std::streamoff inicio = f.tellg();
+	f.seekg(0,std::ios::end);
+	std::streamoff fin = f.tellg();
+	if (inicio<0 or fin<0) return false;
+	const std::streamoff tam_nodo = sizeof(glm::vec3)+1, tam_elemento = sizeof(Elemento);
+	if (fin-inicio!=nn*tam_nodo+ne*tam_elemento) return false;
+	f.seekg(inicio);
+
+	std::vector<glm::vec3> pos(nn);
+	std::vector<char> frontera(nn);
+	e.resize(ne);
+	f.read(reinterpret_cast<char*>(pos.data()),nn*sizeof(glm::vec3));
+	f.read(frontera.data(),nn);
+	f.read(reinterpret_cast<char*>(e.data()),ne*sizeof(Elemento));
+	if (not f) return false;
+
+	n.reserve(nn);
+	for (int i=0;i<nn;i++) {
+		n.push_back(Nodo(pos[i]));
+		n.back().es_frontera = frontera[i]!=0;
+	}
+
+	// indices de nodos y de vecinos en rango (makeElementosDeNodos y el resto
+	// de la malla los usan sin verificar)
+	for (const Elemento &ei : e) {
+		if (ei.nv!=3 and ei.nv!=4) return false;
+		for (int j=0;j<ei.nv;j++)
+			if (ei.n[j]<0 or ei.n[j]>=nn or ei.v[j]<-1 or ei.v[j]>=ne) return false;
+	}
+	makeElementosDeNodos();
+	return true;
+}
+
+bool SubDivMesh::save(const std::string &fname) const {
+	std::ofstream f(fname,std::ios::binary|std::ios::trunc);
+	if (!f.is_open()) return false;
+	int nn = n.size(), ne = e.size();
+	std::vector<glm::vec3> pos; pos.reserve(nn);
+	std::vector<char> frontera; frontera.reserve(nn);
+	for (const Nodo &ni : n) {
+		pos.push_back(ni.p);
+		frontera.push_back(ni.es_frontera?1:0);
+	}
+	f.write(sdm_magic,4);
+	f.write(reinterpret_cast<const char*>(&nn),sizeof(int));
+	f.write(reinterpret_cast<const char*>(&ne),sizeof(int));
+	f.write(reinterpret_cast<const char*>(pos.data()),nn*sizeof(glm::vec3));
+	f.write(frontera.data(),nn);
+	f.write(reinterpret_cast<const char*>(e.data()),ne*sizeof(Elemento));
+	return static_cast<bool>(f);
+}
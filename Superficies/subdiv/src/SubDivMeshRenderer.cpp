@@ -1,4 +1,5 @@
 #include "SubDivMeshRenderer.hpp"
+#include "SubDivSchemes.hpp"
 
 
 SubDivMeshRenderer::SubDivMeshRenderer (const std::vector<glm::vec3> & pos, 
@@ -74,7 +75,7 @@ SubDivMeshRenderer::~SubDivMeshRenderer ( ) {
 	freeResources();
 }
 
-SubDivMeshRenderer makeRenderer(SubDivMesh & m, bool trust_neighbours) {
+SubDivMeshRenderer makeRenderer(SubDivMesh & m, bool trust_neighbours, bool limit, EsquemaSubdiv esquema) {
 	
 	const auto &e = m.e;
 	const auto &n = m.n;
@@ -104,6 +105,18 @@ SubDivMeshRenderer makeRenderer(SubDivMesh & m, bool trust_neighbours) {
 		vpos.push_back(ni.p);
 	}
 	
+	// posiciones y normales en la superficie limite (donde se pueda evaluar,
+	// en el resto quedan las anteriores)
+	if (limit) {
+		#pragma omp parallel for
+		for(int in=0;in<static_cast<int>(n.size());++in) {
+			glm::vec3 p, normal;
+			if (not evaluarLimite(m,in,esquema,p,normal)) continue;
+			vpos[in] = p;
+			vnorms[in] = glm::dot(normal,vnorms[in])<0.f ? -normal : normal;
+		}
+	}
+	
 	std::vector<int> lines, tris;
 	for(int ie=0;ie<static_cast<int>(e.size());++ie) {
 		const Elemento &ei = e[ie];
@@ -2,6 +2,7 @@
 #define SUBDIVMESHRENDERER_HPP
 
 #include "SubDivMesh.hpp"
+#include "SubDivSchemes.hpp"
 #include "Shaders.hpp"
 
 class SubDivMeshRenderer {
@@ -26,7 +27,9 @@ private:
 	int npoints=0, nlines=0, ntris=0;
 };
 
-SubDivMeshRenderer makeRenderer(SubDivMesh &m, bool trust_neighbours=true);
+// con limit=true los nodos se llevan a su posicion en la superficie limite y se
+// usan las normales exactas de la superficie limite del esquema (ver evaluarLimite)
+SubDivMeshRenderer makeRenderer(SubDivMesh &m, bool trust_neighbours=true, bool limit=false, EsquemaSubdiv esquema=SUBDIV_CATMULL_CLARK);
 
 
 #endif
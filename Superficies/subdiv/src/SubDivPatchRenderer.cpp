@@ -0,0 +1,170 @@
+#include "SubDivPatchRenderer.hpp"
+#include "Debug.hpp"
+
+// punto de control interior del parche del elemento ie junto a su esquina k
+static glm::vec3 puntoInterior(const SubDivMesh &m, int ie, int k) {
+	const Elemento &ei = m.e[ie];
+	const Nodo &nk = m.n[ei[k]];
+	float val = nk.es_frontera ? 4.f : float(nk.e.size()); // en el borde se trata como regular
+	return (val*nk.p + 2.f*(m.n[ei[k+1]].p+m.n[ei[k-1]].p) + m.n[ei[k+2]].p)/(val+5.f);
+}
+
+// punto de control de la arista que va de la esquina k a la esquina k+d (d=+1 o -1),
+// el que esta mas cerca de la esquina k
+static glm::vec3 puntoArista(const SubDivMesh &m, int ie, int k, int d) {
+	const Elemento &ei = m.e[ie];
+	int iv = ei.v[(k+(d>0?0:3))%4]; // vecino por esa arista
+	if (iv<0) return (2.f*m.n[ei[k]].p + m.n[ei[k+d]].p)/3.f;
+	return (puntoInterior(m,ie,k) + puntoInterior(m,iv,m.e[iv].Indice(ei[k])))/2.f;
+}
+
+// punto de control de la esquina (posicion limite del nodo in)
+static glm::vec3 puntoEsquina(const SubDivMesh &m, int in) {
+	const Nodo &ni = m.n[in];
+	if (not ni.es_frontera) {
+		glm::vec3 r(0.f);
+		for(int ie : ni.e)
+			r += puntoInterior(m,ie,m.e[ie].Indice(in));
+		return r/float(ni.e.size());
+	}
+	// en el borde, limite de la B-spline cubica que forman las aristas de frontera
+	int vec[2];
+	if (m.vecinosFrontera(in,vec)<2) return ni.p; // frontera no manifold, queda fija
+	return (m.n[vec[0]].p + 4.f*ni.p + m.n[vec[1]].p)/6.f;
+}
+
+std::vector<glm::vec4> makePatches(const SubDivMesh &m) {
+	std::vector<glm::vec3> esquinas(m.n.size());
+	for(size_t in=0;in<m.n.size();++in)
+		if (not m.n[in].e.empty()) esquinas[in] = puntoEsquina(m,in);
+
+	// ubicacion en la grilla de 4x4 (fila*4+columna) de cada tipo de punto para
+	// cada esquina k; la esquina 0 va en (u,v)=(0,0), la 1 en (1,0), la 2 en (1,1)...
+	static const int pos_esquina[4] = { 0, 3, 15, 12 };
+	static const int pos_interior[4] = { 5, 6, 10, 9 };
+	static const int pos_arista_sig[4] = { 1, 7, 14, 8 }; // hacia la esquina k+1
+	static const int pos_arista_ant[4] = { 4, 2, 11, 13 }; // hacia la esquina k-1
+
+	std::vector<glm::vec4> patches(m.e.size()*16);
+	for(int ie=0;ie<static_cast<int>(m.e.size());++ie) {
+		const Elemento &ei = m.e[ie];
+		cg_assert(ei.nv==4,"Los parches requieren una malla de cuadrilateros");
+		glm::vec4 *p = patches.data()+ie*16;
+		for(int k=0;k<4;++k) {
+			p[pos_esquina[k]] = glm::vec4(esquinas[ei[k]],1.f);
+			p[pos_interior[k]] = glm::vec4(puntoInterior(m,ie,k),1.f);
+			p[pos_arista_sig[k]] = glm::vec4(puntoArista(m,ie,k,+1),1.f);
+			p[pos_arista_ant[k]] = glm::vec4(puntoArista(m,ie,k,-1),1.f);
+		}
+	}
+	return patches;
+}
+
+SubDivPatchRenderer::SubDivPatchRenderer(const std::vector<glm::vec4> &patches) {
+	glGenVertexArrays(1,&VAO);
+	glBindVertexArray(VAO);
+	glGenBuffers(2, EBO);
+
+	glGenBuffers(1,&TBO);
+	glBindBuffer(GL_TEXTURE_BUFFER, TBO);
+	glBufferData(GL_TEXTURE_BUFFER, patches.size()*sizeof(glm::vec4), patches.data(), GL_STATIC_DRAW);
+	glGenTextures(1,&TEX);
+	glBindTexture(GL_TEXTURE_BUFFER, TEX);
+	glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, TBO);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+	npatches = patches.size()/16;
+	glBindVertexArray(0);
+	setLevel(0);
+}
+
+void SubDivPatchRenderer::setLevel(int new_level) {
+	if (new_level<0) new_level = 0;
+	if (new_level>max_level) new_level = max_level;
+	if (VAO==0 or new_level==level) return;
+	level = new_level;
+
+	// grilla de indices comun a todos los parches, el vertex shader obtiene
+	// (u,v) a partir del indice (gl_VertexID) y el parche de gl_InstanceID
+	int res = 1<<level, side = res+1;
+	std::vector<int> lines, tris;
+	lines.reserve(4*res*side); tris.reserve(6*res*res);
+	for(int j=0;j<side;++j) {
+		for(int i=0;i<side;++i) {
+			int k = j*side+i;
+			if (i<res) { lines.push_back(k); lines.push_back(k+1); }
+			if (j<res) { lines.push_back(k); lines.push_back(k+side); }
+			if (i<res and j<res) {
+				tris.push_back(k); tris.push_back(k+1); tris.push_back(k+side+1);
+				tris.push_back(k); tris.push_back(k+side+1); tris.push_back(k+side);
+			}
+		}
+	}
+	nlines = lines.size(); ntris = tris.size();
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO[0]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, lines.size()*sizeof(int), lines.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, tris.size()*sizeof(int), tris.data(), GL_STATIC_DRAW);
+	glBindVertexArray(0);
+}
+
+void SubDivPatchRenderer::bindPatches(Shader &shader) const {
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_BUFFER, TEX);
+	shader.setUniform("patchData",0);
+	shader.setUniform("gridSize",(1<<level)+1);
+}
+
+void SubDivPatchRenderer::drawLines(Shader &shader) const {
+	if (npatches==0) return;
+	glBindVertexArray(VAO);
+	bindPatches(shader);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO[0]);
+	glDrawElementsInstanced(GL_LINES,nlines,GL_UNSIGNED_INT,0,npatches);
+	glBindVertexArray(0);
+}
+
+void SubDivPatchRenderer::drawTriangles(Shader &shader) const {
+	if (npatches==0) return;
+	glBindVertexArray(VAO);
+	bindPatches(shader);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO[1]);
+	glPolygonOffset(1,1);
+	glEnable( GL_POLYGON_OFFSET_FILL );
+	glDrawElementsInstanced(GL_TRIANGLES,ntris,GL_UNSIGNED_INT,0,npatches);
+	glDisable( GL_POLYGON_OFFSET_FILL );
+	glBindVertexArray(0);
+}
+
+void SubDivPatchRenderer::freeResources( ) {
+	if (VAO==0) return;
+	glDeleteTextures(1,&TEX);
+	glDeleteBuffers(1,&TBO);
+	glDeleteBuffers(2,EBO);
+	glDeleteVertexArrays(1,&VAO);
+}
+
+SubDivPatchRenderer::~SubDivPatchRenderer ( ) {
+	freeResources();
+}
+
+SubDivPatchRenderer makePatchRenderer(const SubDivMesh &m, int level) {
+	SubDivPatchRenderer r(makePatches(m));
+	r.setLevel(level);
+	return r;
+}
+
+SubDivPatchRenderer::SubDivPatchRenderer (SubDivPatchRenderer &&o) {
+	*this = static_cast<const SubDivPatchRenderer&>(o);
+	o = static_cast<const SubDivPatchRenderer&>(SubDivPatchRenderer());
+}
+
+SubDivPatchRenderer &SubDivPatchRenderer::operator=(SubDivPatchRenderer &&o) {
+	freeResources();
+	*this = static_cast<const SubDivPatchRenderer&>(o);
+	o = static_cast<const SubDivPatchRenderer&>(SubDivPatchRenderer());
+	return *this;
+}
@@ -0,0 +1,44 @@
+#ifndef SUBDIVPATCHRENDERER_HPP
+#define SUBDIVPATCHRENDERER_HPP
+
+#include "SubDivMesh.hpp"
+#include "Shaders.hpp"
+
+// Vista previa de la subdivision evaluada en la GPU: por cada cuadrilatero de la
+// malla base se sube un parche bicubico de Bezier (16 puntos de control, en un
+// texture buffer) y el vertex shader (shaders/patch.vert) evalua una grilla de
+// (2^nivel+1)x(2^nivel+1) puntos por parche, dibujando un parche por instancia.
+// Cambiar de nivel solo cambia la grilla de indices, no se toca la malla.
+class SubDivPatchRenderer {
+public:
+	static constexpr int max_level = 6;
+	SubDivPatchRenderer() = default;
+	SubDivPatchRenderer(const std::vector<glm::vec4> &patches);
+	SubDivPatchRenderer(SubDivPatchRenderer &&o);
+	SubDivPatchRenderer &operator=(SubDivPatchRenderer &&o);
+	void setLevel(int level);
+	int getLevel() const { return level; }
+	void drawLines(Shader &shader) const;
+	void drawTriangles(Shader &shader) const;
+	int GetNumberOfPatches() const { return npatches; }
+	~SubDivPatchRenderer();
+private:
+	void bindPatches(Shader &shader) const;
+	void freeResources();
+	SubDivPatchRenderer(const SubDivPatchRenderer &) = delete;
+	SubDivPatchRenderer &operator=(const SubDivPatchRenderer &) = default;
+	GLuint VAO=0, TBO=0, TEX=0, EBO[2]; // EBO = { EBO_lines, EBO_triangles }
+	int npatches=0, level=-1, nlines=0, ntris=0;
+};
+
+// Arma los parches de Bezier que aproximan la superficie limite de Catmull-Clark
+// (ACC: el punto interior de cada esquina es (n*v+2*e0+2*e1+f)/(n+5), los de las
+// aristas y esquinas son promedios de los interiores que las rodean); en parches
+// regulares coincide exactamente con la superficie limite.
+// Requiere que la malla sea solo de cuadrilateros (con una subdivision alcanza).
+std::vector<glm::vec4> makePatches(const SubDivMesh &m);
+
+SubDivPatchRenderer makePatchRenderer(const SubDivMesh &m, int level);
+
+#endif
+
@@ -0,0 +1,208 @@
+#include <cmath>
+#include "SubDivSchemes.hpp"
+#include "Debug.hpp"
+
+constexpr float PI = 3.14159265359f;
+
+// Parte cada cuadrilatero en dos triangulos (no hace nada si ya son todos triangulos)
+static void triangular(SubDivMesh &mesh) {
+	int nq = 0;
+	for (const Elemento &ei : mesh.e) if (ei.nv==4) ++nq;
+	if (nq==0) return;
+	std::vector<Elemento> e;
+	e.reserve(mesh.e.size()+nq);
+	for (const Elemento &ei : mesh.e) {
+		e.push_back(Elemento(ei[0],ei[1],ei[2]));
+		if (ei.nv==4) e.push_back(Elemento(ei[0],ei[2],ei[3]));
+	}
+	mesh.e.swap(e);
+	mesh.makeElementosDeNodos();
+	mesh.makeVecinos();
+}
+
+// Reemplaza todos los elementos por los nuevos, y agrega los nodos nuevos
+// (pos tiene las posiciones de todos, los primeros son los originales)
+static void reemplazarMalla(SubDivMesh &mesh, std::vector<Elemento> &e, const std::vector<glm::vec3> &pos) {
+	int n_orig = mesh.n.size();
+	for (int i=0;i<n_orig;i++) mesh.n[i].p = pos[i];
+	mesh.n.reserve(pos.size());
+	for (size_t i=n_orig;i<pos.size();i++) mesh.n.push_back(Nodo(pos[i]));
+	mesh.e.swap(e);
+	mesh.makeElementosDeNodos();
+	mesh.makeVecinos();
+	mesh.verificarIntegridad();
+}
+
+// indice (en el elemento vecino iv) del nodo donde empieza la arista j de ie
+// (el vecino la recorre en sentido contrario, asi que es donde esta el 2do nodo de la arista)
+static int aristaEnVecino(const SubDivMesh &mesh, int ie, int j, int iv) {
+	int k = mesh.e[iv].Indice(mesh.e[ie][j+1]);
+	cg_assert(k>=0 and mesh.e[iv][k+1]==mesh.e[ie][j],"Vecinos inconsistentes");
+	return k;
+}
+
+void subdivideLoop(SubDivMesh &mesh) {
+	triangular(mesh);
+	const auto &e = mesh.e;
+	const auto &n = mesh.n;
+	int n_orig = n.size(), e_orig = e.size();
+
+	// numera las aristas: cada una la numera el elemento de menor indice, el
+	// otro copia el numero (su vecino ya se proceso por tener menor indice) y
+	// anota su nodo opuesto a la arista
+	std::vector<int> arista(3*e_orig), opuesto(3*e_orig,-1);
+	int na = 0;
+	for (int ie=0;ie<e_orig;ie++) {
+		for (int j=0;j<3;j++) {
+			int iv = e[ie].v[j];
+			if (iv<0 or iv>ie) arista[3*ie+j] = na++;
+			else {
+				arista[3*ie+j] = arista[3*iv+aristaEnVecino(mesh,ie,j,iv)];
+				opuesto[arista[3*ie+j]] = e[ie][j+2];
+			}
+		}
+	}
+
+	std::vector<glm::vec3> pos(n_orig+na);
+
+	// nodos nuevos en las aristas: 3/8 de los extremos y 1/8 de los opuestos
+	#pragma omp parallel for
+	for (int ie=0;ie<e_orig;ie++) {
+		const Elemento &ei = e[ie];
+		for (int j=0;j<3;j++) {
+			int iv = ei.v[j];
+			if (iv>=0 and iv<ie) continue; // la calcula el vecino
+			glm::vec3 a = n[ei[j]].p, b = n[ei[j+1]].p;
+			int ia = arista[3*ie+j];
+			if (iv<0) pos[n_orig+ia] = (a+b)*.5f;
+			else pos[n_orig+ia] = (a+b)*(3.f/8.f) + (n[ei[j+2]].p + n[opuesto[ia]].p)*(1.f/8.f);
+		}
+	}
+
+	// nodos originales
+	#pragma omp parallel for
+	for (int in=0;in<n_orig;in++) {
+		const Nodo &ni = n[in];
+		pos[in] = ni.p;
+		if (ni.e.empty()) continue;
+		if (ni.es_frontera) {
+			int vec[2];
+			if (mesh.vecinosFrontera(in,vec)==2)
+				pos[in] = ni.p*.75f + (n[vec[0]].p+n[vec[1]].p)*.125f;
+		} else {
+			glm::vec3 r(0.f);
+			for (int ie : ni.e) r += n[e[ie][e[ie].Indice(in)+1]].p;
+			float k = ni.e.size(), c = 3.f/8.f + std::cos(2.f*PI/k)/4.f;
+			float beta = (5.f/8.f - c*c)/k;
+			pos[in] = ni.p*(1.f-k*beta) + r*beta;
+		}
+	}
+
+	// cada triangulo se parte en 4, en las posiciones 4*ie a 4*ie+3
+	std::vector<Elemento> e_nuevos(4*e_orig);
+	#pragma omp parallel for
+	for (int ie=0;ie<e_orig;ie++) {
+		const Elemento &ei = e[ie];
+		int m01 = n_orig+arista[3*ie], m12 = n_orig+arista[3*ie+1], m20 = n_orig+arista[3*ie+2];
+		e_nuevos[4*ie+0].SetNodos(ei[0],m01,m20);
+		e_nuevos[4*ie+1].SetNodos(m01,ei[1],m12);
+		e_nuevos[4*ie+2].SetNodos(m20,m12,ei[2]);
+		e_nuevos[4*ie+3].SetNodos(m01,m12,m20);
+	}
+
+	reemplazarMalla(mesh,e_nuevos,pos);
+}
+
+void subdivideSqrt3(SubDivMesh &mesh) {
+	triangular(mesh);
+	const auto &e = mesh.e;
+	const auto &n = mesh.n;
+	int n_orig = n.size(), e_orig = e.size();
+	std::vector<glm::vec3> pos(n_orig+e_orig);
+
+	// un nodo nuevo en el centroide de cada triangulo
+	#pragma omp parallel for
+	for (int ie=0;ie<e_orig;ie++) {
+		const Elemento &ei = e[ie];
+		pos[n_orig+ie] = (n[ei[0]].p+n[ei[1]].p+n[ei[2]].p)/3.f;
+	}
+
+	// nodos originales: (1-a)*p + a*promedio de los vecinos, a=(4-2cos(2pi/n))/9
+	#pragma omp parallel for
+	for (int in=0;in<n_orig;in++) {
+		const Nodo &ni = n[in];
+		pos[in] = ni.p;
+		if (ni.e.empty() or ni.es_frontera) continue;
+		glm::vec3 r(0.f);
+		for (int ie : ni.e) r += n[e[ie][e[ie].Indice(in)+1]].p;
+		float k = ni.e.size(), alpha = (4.f-2.f*std::cos(2.f*PI/k))/9.f;
+		pos[in] = ni.p*(1.f-alpha) + r*(alpha/k);
+	}
+
+	// por cada arista interior quedan dos triangulos que unen los centroides de los
+	// dos elementos que la comparten con cada extremo; cada elemento arma el del
+	// nodo donde empieza la arista (el vecino arma el otro), en la posicion 3*ie+j
+	std::vector<Elemento> e_nuevos(3*e_orig);
+	#pragma omp parallel for
+	for (int ie=0;ie<e_orig;ie++) {
+		const Elemento &ei = e[ie];
+		int c = n_orig+ie;
+		for (int j=0;j<3;j++) {
+			int iv = ei.v[j];
+			if (iv<0) e_nuevos[3*ie+j].SetNodos(ei[j],ei[j+1],c);
+			else      e_nuevos[3*ie+j].SetNodos(ei[j],n_orig+iv,c);
+		}
+	}
+
+	reemplazarMalla(mesh,e_nuevos,pos);
+}
+
+bool evaluarLimite(const SubDivMesh &mesh, int in, EsquemaSubdiv esquema, glm::vec3 &pos, glm::vec3 &normal) {
+	const Nodo &ni = mesh.n[in];
+	int val = ni.e.size();
+	if (ni.es_frontera or val<3) return false;
+	int nv = esquema==SUBDIV_CATMULL_CLARK ? 4 : 3;
+	float w = 2.f*PI/val, cw = std::cos(w);
+	float A = 1.f + cw + std::cos(w/2.f)*std::sqrt(2.f*(9.f+cw));
+	
+	// recorre el anillo en orden (pasando al vecino por la arista que llega al
+	// nodo) acumulando las mascaras, sin guardarlo
+	glm::vec3 se(0.f), sf(0.f), t1(0.f), t2(0.f);
+	int ie = ni.e[0];
+	for (int i=0;i<val;i++) {
+		const Elemento &ei = mesh.e[ie];
+		int j = ei.Indice(in);
+		if (ei.nv!=nv or j<0) return false;
+		const glm::vec3 &pe = mesh.n[ei[j+1]].p;
+		se += pe;
+		if (nv==4) {
+			const glm::vec3 &pf = mesh.n[ei[j+2]].p;
+			sf += pf;
+			float c0 = std::cos(w*(i-1)), c1 = std::cos(w*i), c2 = std::cos(w*(i+1));
+			t1 += pe*(A*c1) + pf*(c1+c2);
+			t2 += pe*(A*c0) + pf*(c0+c1);
+		} else {
+			t1 += pe*std::cos(w*i);
+			t2 += pe*std::sin(w*i);
+		}
+		ie = ei.v[(j+nv-1)%nv];
+		if (ie<0) return false;
+	}
+	if (ie!=ni.e[0]) return false; // no cerro el anillo (malla no manifold)
+	
+	glm::vec3 nrm = glm::cross(t1,t2);
+	if (glm::dot(nrm,nrm)==0.f) return false;
+	normal = glm::normalize(nrm);
+	if (nv==4) {
+		pos = (ni.p*float(val*val) + se*4.f + sf)/float(val*(val+5));
+	} else if (esquema==SUBDIV_SQRT3) {
+		// un paso lleva p a (1-a)p+a*q (q: promedio del anillo) y el promedio
+		// del anillo nuevo (centroides) a (p+2q)/3; lo que no cambia es (p+3a*q)/(1+3a)
+		float alpha = (4.f-2.f*cw)/9.f;
+		pos = (ni.p + se*(3.f*alpha/val))/(1.f+3.f*alpha);
+	} else {
+		float c = 3.f/8.f + cw/4.f, beta = (5.f/8.f - c*c)/val, omega = 3.f/(8.f*beta);
+		pos = (ni.p*omega + se)/(omega+val);
+	}
+	return true;
+}
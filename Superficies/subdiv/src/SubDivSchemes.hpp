@@ -0,0 +1,29 @@
+#ifndef SUBDIVSCHEMES_HPP
+#define SUBDIVSCHEMES_HPP
+
+#include "SubDivMesh.hpp"
+
+// Esquemas de subdivision para mallas de triangulos (si hay cuadrilateros,
+// primero se parten en dos triangulos). Ambos arman la malla nueva de una vez
+// (sin agregarElemento/reemplazarElemento) y calculan las posiciones en paralelo.
+
+// Loop: agrega un nodo por arista y parte cada triangulo en 4
+void subdivideLoop(SubDivMesh &mesh);
+
+// raiz de 3 (Kobbelt): agrega un nodo por triangulo y da vuelta las aristas
+// originales, cada triangulo se reemplaza por 3. Las aristas de frontera no se
+// refinan (cada una queda en un triangulo con el centroide) y sus nodos no se mueven.
+void subdivideSqrt3(SubDivMesh &mesh);
+
+// los esquemas, en el orden del combo de main
+enum EsquemaSubdiv { SUBDIV_CATMULL_CLARK, SUBDIV_LOOP, SUBDIV_SQRT3 };
+
+// Posicion y normal en la superficie limite del nodo in para el esquema dado:
+// Catmull-Clark requiere que su anillo sea de cuadrilateros, Loop y raiz de 3
+// que sea de triangulos (las normales son las mismas en los dos, cambia la
+// posicion). Retorna false (sin modificar pos ni normal) para nodos de
+// frontera, con anillos mixtos o con elementos que no son los del esquema.
+bool evaluarLimite(const SubDivMesh &mesh, int in, EsquemaSubdiv esquema, glm::vec3 &pos, glm::vec3 &normal);
+
+#endif
+
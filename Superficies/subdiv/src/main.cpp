@@ -13,20 +13,26 @@
 #include "Shaders.hpp"
 #include "SubDivMesh.hpp"
 #include "SubDivMeshRenderer.hpp"
+#include "SubDivPatchRenderer.hpp"
+#include "SubDivSchemes.hpp"
 
 #define VERSION 20241025
 
 // models and settings
 std::vector<std::string> models_names = { "cubo", "icosahedron", "plano", "suzanne", "star" };
 int current_model = 0;
+std::vector<std::string> schemes_names = { "Catmull-Clark", "Loop", "Sqrt(3)" };
+int current_scheme = 0;
 bool fill = true, nodes = true, wireframe = true, smooth = false, 
-	 reload_mesh = true, mesh_modified = false;
+	 reload_mesh = true, mesh_modified = false, gpu_preview = false, limit = false;
+int preview_level = 2;
 
 // extraa callbacks
 void keyboardCallback(GLFWwindow* glfw_win, int key, int scancode, int action, int mods);
 
 SubDivMesh mesh;
 void subdivide(SubDivMesh &mesh);
+void subdivideWithScheme(SubDivMesh &mesh);
 
 int main() {
 	
@@ -42,8 +48,14 @@ int main() {
 	glClearColor(0.8f,0.8f,0.9f,1.f);
 	Shader shader_flat("shaders/flat"),
 	       shader_smooth("shaders/smooth"),
-		   shader_wireframe("shaders/wireframe");
+		   shader_wireframe("shaders/wireframe"),
+	       shader_patch_flat("shaders/patch.vert","shaders/flat.frag"),
+	       shader_patch_smooth("shaders/patch.vert","shaders/smooth.frag"),
+	       shader_patch_wireframe("shaders/patch.vert","shaders/wireframe.frag");
 	SubDivMeshRenderer renderer;
+	SubDivPatchRenderer patch_renderer;
+	bool patches_modified = true;
+	std::string integrity_msg, sdm_msg; // sdm_msg: error al guardar/cargar el .sdm
 	
 	// main loop
 	Material material;
@@ -58,12 +70,24 @@ int main() {
 		
 		if (reload_mesh) {
 			mesh = SubDivMesh("models/"+models_names[current_model]+".dat");
-			reload_mesh = false; mesh_modified = true;
+			reload_mesh = false; mesh_modified = true; integrity_msg.clear(); sdm_msg.clear();
 		}
 		if (mesh_modified) {
-			renderer = makeRenderer(mesh,false);
-			mesh_modified = false;
+			renderer = makeRenderer(mesh,false,limit,static_cast<EsquemaSubdiv>(current_scheme));
+			mesh_modified = false; patches_modified = true;
 		}
+		if (current_scheme!=0) gpu_preview = false; // los parches son solo para Catmull-Clark
+		if (gpu_preview and patches_modified) {
+			// los parches requieren cuadrilateros, si hay triangulos se subdivide una copia
+			auto no_es_quad = [](const Elemento &ei) { return ei.nv!=4; };
+			if (std::any_of(mesh.e.begin(),mesh.e.end(),no_es_quad)) {
+				SubDivMesh quads = mesh; subdivide(quads);
+				patch_renderer = makePatchRenderer(quads,preview_level);
+			} else
+				patch_renderer = makePatchRenderer(mesh,preview_level);
+			patches_modified = false;
+		}
+		patch_renderer.setLevel(preview_level);
 		
 		if (nodes) {
 			shader_wireframe.use();
@@ -72,18 +96,22 @@ int main() {
 		}
 		
 		if (wireframe) {
-			shader_wireframe.use();
-			setMatrixes(shader_wireframe);
-			renderer.drawLines(shader_wireframe);
+			Shader &shader = gpu_preview ? shader_patch_wireframe : shader_wireframe;
+			shader.use();
+			setMatrixes(shader);
+			if (gpu_preview) patch_renderer.drawLines(shader);
+			else             renderer.drawLines(shader);
 		}
 		
 		if (fill) {
-			Shader &shader = smooth ? shader_smooth : shader_flat;
+			Shader &shader = gpu_preview ? (smooth ? shader_patch_smooth : shader_patch_flat) 
+			                             : (smooth ? shader_smooth : shader_flat);
 			shader.use();
 			setMatrixes(shader);
 			shader.setLight(glm::vec4{2.f,1.f,5.f,0.f}, glm::vec3{1.f,1.f,1.f}, 0.25f);
 			shader.setMaterial(material);
-			renderer.drawTriangles(shader);
+			if (gpu_preview) patch_renderer.drawTriangles(shader);
+			else             renderer.drawTriangles(shader);
 		}
 		
 		// settings sub-window
@@ -93,9 +121,26 @@ int main() {
 			ImGui::Checkbox("Wireframe (W)",&wireframe);
 			ImGui::Checkbox("Nodes (N)",&nodes);
 			ImGui::Checkbox("Smooth Shading (S)",&smooth);
-			if (ImGui::Button("Subdivide (D)")) { subdivide(mesh); mesh_modified = true; }
+			if (ImGui::Checkbox("Limit Surface (L)",&limit)) mesh_modified = true;
+			if (ImGui::Combo("Scheme",&current_scheme,schemes_names) and limit) mesh_modified = true; // la superficie limite depende del esquema
+			if (current_scheme==0) ImGui::Checkbox("GPU Preview (G)",&gpu_preview);
+			if (gpu_preview) ImGui::SliderInt("Preview level",&preview_level,0,SubDivPatchRenderer::max_level);
+			if (ImGui::Button("Subdivide (D)")) { subdivideWithScheme(mesh); mesh_modified = true; }
 			if (ImGui::Button("Reset (R)")) reload_mesh = true;
+			std::string sdm_name = "models/"+models_names[current_model]+".sdm";
+			if (ImGui::Button("Save .sdm")) sdm_msg = mesh.save(sdm_name) ? "" : "Could not save "+sdm_name;
+			ImGui::SameLine();
+			if (ImGui::Button("Load .sdm")) {
+				if (mesh.load(sdm_name)) { mesh_modified = true; sdm_msg.clear(); }
+				else sdm_msg = "Could not load "+sdm_name+" (missing or malformed)";
+			}
+			if (not sdm_msg.empty()) ImGui::TextColored(ImVec4(1.f,.3f,.3f,1.f),"%s",sdm_msg.c_str());
 			ImGui::Text("Nodes: %i, Elements: %i",mesh.n.size(),mesh.e.size());
+			if (ImGui::Button("Verify")) { // verificacion completa, aunque subdivide solo haga un muestreo
+				try { mesh.verificarIntegridad(0); integrity_msg = "OK"; }
+				catch (std::exception &ex) { integrity_msg = ex.what(); }
+			}
+			if (not integrity_msg.empty()) { ImGui::SameLine(); ImGui::TextWrapped("%s",integrity_msg.c_str()); }
 		});
 		
 		// finish frame
@@ -107,17 +152,27 @@ int main() {
 void keyboardCallback(GLFWwindow* glfw_win, int key, int scancode, int action, int mods) {
 	if (action==GLFW_PRESS) {
 		switch (key) {
-		case 'D': subdivide(mesh); mesh_modified = true; break;
+		case 'D': subdivideWithScheme(mesh); mesh_modified = true; break;
 		case 'F': fill = !fill; break;
 		case 'N': nodes = !nodes; break;
 		case 'W': wireframe = !wireframe; break;
 		case 'S': smooth = !smooth; break;
+		case 'L': limit = !limit; mesh_modified = true; break;
+		case 'G': gpu_preview = !gpu_preview; break;
 		case 'R': reload_mesh=true; break;
 		case 'O': case 'M': current_model = (current_model+1)%models_names.size(); reload_mesh = true; break;
 		}
 	}
 }
 
+void subdivideWithScheme(SubDivMesh &mesh) {
+	switch (current_scheme) {
+	case 1: subdivideLoop(mesh); break;
+	case 2: subdivideSqrt3(mesh); break;
+	default: subdivide(mesh);
+	}
+}
+
 // La struct Arista guarda los dos indices de nodos de una arista
 // Siempre pone primero el menor indice, para facilitar la bsqueda en lista ordenada;
 //    es para usar con el Mapa de ms abajo, para asociar un nodo nuevo a una arista vieja